@@ -0,0 +1,205 @@
+#include "BuildCache.h"
+#include "Main.h"
+#include "VersionInfo.h"
+#include <Globals.h>
+#include <Utils/File.h>
+#include <Utils/StringHelper.h>
+#include <tinyxml2.h>
+#include <filesystem>
+#include <fstream>
+#include <unordered_set>
+
+// Bump this whenever an exporter changes its output without changing its resource version.
+#define BUILD_CACHE_VERSION 1
+
+static std::filesystem::path cacheDirectory;
+
+struct BuildCacheRecording
+{
+	bool active = false;
+	uint64_t key = 0;
+	std::vector<std::pair<std::string, std::vector<char>>> entries;
+	std::unordered_set<std::string> names;
+};
+
+// Each worker thread extracts one XML at a time, so recordings are per thread
+static thread_local BuildCacheRecording recording;
+
+static uint64_t HashBytes(uint64_t hash, const void* data, size_t size)
+{
+	const uint8_t* bytes = (const uint8_t*)data;
+
+	// FNV-1a
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= bytes[i];
+		hash *= 0x100000001B3ULL;
+	}
+
+	return hash;
+}
+
+static uint64_t HashString(uint64_t hash, const std::string& str)
+{
+	uint32_t size = str.size();
+	hash = HashBytes(hash, &size, sizeof(size));
+	return HashBytes(hash, str.data(), str.size());
+}
+
+static uint64_t HashFile(uint64_t hash, const std::string& path)
+{
+	std::vector<uint8_t> data = File::Exists(path) ? File::ReadAllBytes(path) : std::vector<uint8_t>();
+	uint32_t size = data.size();
+	hash = HashBytes(hash, &size, sizeof(size));
+	return HashBytes(hash, data.data(), data.size());
+}
+
+static uint64_t ComputeKey(const std::string& xmlPath)
+{
+	uint64_t hash = 0xCBF29CE484222325ULL;
+	uint32_t version = BUILD_CACHE_VERSION;
+
+	hash = HashBytes(hash, &version, sizeof(version));
+
+	for (const auto& [type, resVersion] : resourceVersions)
+	{
+		uint32_t entry[2] = { (uint32_t)type, resVersion };
+		hash = HashBytes(hash, entry, sizeof(entry));
+	}
+
+	// The output names depend on where the XML lives, not just on what it contains
+	hash = HashString(hash, xmlPath);
+	hash = HashFile(hash, xmlPath);
+
+	// Config and external XMLs are parsed alongside every XML for symbol lookups
+	hash = HashFile(hash, Globals::Instance->cfg.configFilePath);
+	for (const auto& extFile : Globals::Instance->cfg.externalFiles)
+		hash = HashFile(hash, (Globals::Instance->cfg.externalXmlFolder / extFile.xmlPath).string());
+
+	tinyxml2::XMLDocument doc;
+	if (doc.LoadFile(xmlPath.c_str()) == tinyxml2::XML_SUCCESS && doc.FirstChildElement() != nullptr)
+	{
+		for (tinyxml2::XMLElement* child = doc.FirstChildElement()->FirstChildElement(); child != nullptr;
+		     child = child->NextSiblingElement())
+		{
+			if (std::string(child->Name()) != "File")
+				continue;
+
+			const char* name = child->Attribute("Name");
+			if (name == nullptr)
+				continue;
+
+			const std::vector<uint8_t>& data = Globals::Instance->rom->GetFile(name);
+			hash = HashString(hash, name);
+			hash = HashBytes(hash, data.data(), data.size());
+		}
+	}
+
+	return hash;
+}
+
+static std::filesystem::path GetCachePath(uint64_t key)
+{
+	return cacheDirectory / StringHelper::Sprintf("%016llX.bin", (unsigned long long)key);
+}
+
+void BuildCache_SetDirectory(const std::string& directory)
+{
+	cacheDirectory = directory;
+	std::filesystem::create_directories(cacheDirectory);
+}
+
+bool BuildCache_Begin(const std::string& xmlPath)
+{
+	if (cacheDirectory.empty() || Globals::Instance->rom == nullptr)
+		return false;
+
+	uint64_t key = ComputeKey(xmlPath);
+	std::ifstream cacheFile(GetCachePath(key), std::ios::binary);
+
+	if (cacheFile.is_open())
+	{
+		std::vector<std::pair<std::string, std::vector<char>>> entries;
+		uint32_t count = 0;
+		cacheFile.read((char*)&count, sizeof(count));
+
+		for (uint32_t i = 0; i < count && cacheFile.good(); i++)
+		{
+			uint32_t nameSize = 0;
+			uint32_t dataSize = 0;
+			std::string name;
+			std::vector<char> data;
+
+			cacheFile.read((char*)&nameSize, sizeof(nameSize));
+			name.resize(nameSize);
+			cacheFile.read(name.data(), nameSize);
+			cacheFile.read((char*)&dataSize, sizeof(dataSize));
+			data.resize(dataSize);
+			cacheFile.read(data.data(), dataSize);
+
+			entries.emplace_back(std::move(name), std::move(data));
+		}
+
+		// A truncated entry is treated as a miss and gets rewritten below
+		if (cacheFile.good() && entries.size() == count)
+		{
+			for (auto& [name, data] : entries)
+				AddFile(name, std::move(data));
+
+			return true;
+		}
+	}
+
+	recording.active = true;
+	recording.key = key;
+	recording.entries.clear();
+	recording.names.clear();
+	return false;
+}
+
+void BuildCache_End(const std::string& xmlPath, bool success)
+{
+	if (!recording.active)
+		return;
+
+	recording.active = false;
+
+	if (success)
+	{
+		// Write to a temporary file first so an interrupted build never leaves a partial entry behind
+		std::filesystem::path cachePath = GetCachePath(recording.key);
+		std::filesystem::path tempPath = cachePath;
+		tempPath += ".tmp";
+
+		{
+			std::ofstream cacheFile(tempPath, std::ios::binary | std::ios::trunc);
+			uint32_t count = recording.entries.size();
+			cacheFile.write((const char*)&count, sizeof(count));
+
+			for (const auto& [name, data] : recording.entries)
+			{
+				uint32_t nameSize = name.size();
+				uint32_t dataSize = data.size();
+				cacheFile.write((const char*)&nameSize, sizeof(nameSize));
+				cacheFile.write(name.data(), nameSize);
+				cacheFile.write((const char*)&dataSize, sizeof(dataSize));
+				cacheFile.write(data.data(), dataSize);
+			}
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(tempPath, cachePath, ec);
+		if (ec)
+			std::filesystem::remove(tempPath, ec);
+	}
+
+	recording.entries.clear();
+	recording.names.clear();
+}
+
+void BuildCache_Record(const std::string& fName, const std::vector<char>& data)
+{
+	// A resource referenced from several places in the same XML is only stored once
+	if (recording.active && recording.names.insert(fName).second)
+		recording.entries.emplace_back(fName, data);
+}
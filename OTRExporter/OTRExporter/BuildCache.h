@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Persistent cache of the resources exported from each XML, enabled with --cache <dir>.
+// Entries are keyed by a hash of the XML, the baserom files it references, the config
+// XMLs and the exporter's resource versions, so an XML is only re-extracted when one of
+// those changes.
+
+void BuildCache_SetDirectory(const std::string& directory);
+
+// Restores the resources previously exported from xmlPath and returns true on a hit.
+// On a miss, starts recording the resources exported on this thread and returns false.
+bool BuildCache_Begin(const std::string& xmlPath);
+
+// Stops recording and, if the extraction succeeded, stores what was recorded.
+void BuildCache_End(const std::string& xmlPath, bool success);
+
+// Called for every resource exported while recording, and for every already exported resource
+// the XML references, so a cache hit restores everything the XML needs.
+void BuildCache_Record(const std::string& fName, const std::vector<char>& data);
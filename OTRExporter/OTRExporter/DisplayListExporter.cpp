@@ -356,7 +356,7 @@ void OTRExporter_DisplayList::Save(ZResource* res, const fs::path& outPath, Bina
 					//std::string fName = StringHelper::Sprintf("%s\\%s", GetParentFolderName(res).c_str(), dListDecl2->varName.c_str());
 					std::string fName = OTRExporter_DisplayList::GetPathToRes(res, dListDecl2->varName.c_str());
 
-					if (files.find(fName) == files.end() && !File::Exists("Extract/" + fName))
+					if (!HasFile(fName))
 					{
 						MemoryStream* dlStream = new MemoryStream();
 						BinaryWriter dlWriter = BinaryWriter(dlStream);
@@ -442,7 +442,7 @@ void OTRExporter_DisplayList::Save(ZResource* res, const fs::path& outPath, Bina
 						//std::string fName = StringHelper::Sprintf("%s\\%s", GetParentFolderName(res).c_str(), dListDecl2->varName.c_str());
 						std::string fName = OTRExporter_DisplayList::GetPathToRes(res, dListDecl2->varName.c_str());
 
-						if (files.find(fName) == files.end() && !File::Exists("Extract/" + fName))
+						if (!HasFile(fName))
 						{
 							MemoryStream* dlStream = new MemoryStream();
 							BinaryWriter dlWriter = BinaryWriter(dlStream);
@@ -767,23 +767,22 @@ void OTRExporter_DisplayList::Save(ZResource* res, const fs::path& outPath, Bina
 					word0 = hash >> 32;
 					word1 = hash & 0xFFFFFFFF;
 
-					if (files.find(fName) == files.end() && !File::Exists("Extract/" + fName))
+					if (!HasFile(fName))
 					{
 						// Write vertices to file
 						MemoryStream* vtxStream = new MemoryStream();
 						BinaryWriter vtxWriter = BinaryWriter(vtxStream);
 
-						int arrCnt = 0;
+						// Only Vtx declarations with a body hold vertex data in this file. Anything else the
+						// address resolves to (or a vertex in an unknown segment) exports an empty array, as before.
+						const auto& rawData = dList->parent->GetRawData();
+						size_t arrCnt = 0;
 
-						auto split = StringHelper::Split(vtxDecl->text, "\n");
+						if (vtxDecl->varType == "Vtx" && !vtxDecl->text.empty())
+							arrCnt = vtxDecl->size / 16;
 
-						for (size_t i = 0; i < split.size(); i++)
-						{
-							std::string line = split[i];
-
-							if (StringHelper::Contains(line, "VTX("))
-								arrCnt++;
-						}
+						if (vtxDecl->address + (arrCnt * 16) > rawData.size())
+							arrCnt = 0;
 
 						// OTRTODO: Once we aren't relying on text representations, we should call ArrayExporter...
 						OTRExporter::WriteHeader(nullptr, "", &vtxWriter, Ship::ResourceType::Array);
@@ -791,37 +790,27 @@ void OTRExporter_DisplayList::Save(ZResource* res, const fs::path& outPath, Bina
 						vtxWriter.Write((uint32_t)ZResourceType::Vertex);
 						vtxWriter.Write((uint32_t)arrCnt);
 
-						auto start = std::chrono::steady_clock::now();
-
-						// God dammit this is so dumb
-						for (size_t i = 0; i < split.size(); i++)
+						// Copy the vertices straight out of the file data instead of parsing them back out of the declaration text.
+						for (size_t i = 0; i < arrCnt; i++)
 						{
-							std::string line = split[i];
-
-							if (StringHelper::Contains(line, "VTX("))
-							{
-								auto split2 = StringHelper::Split(StringHelper::Split(StringHelper::Split(line, "VTX(")[1], ")")[0], ",");
+							const size_t vtxOffset = vtxDecl->address + (i * 16);
 
-								vtxWriter.Write((int16_t)std::stoi(split2[0], nullptr, 10)); // v.x
-								vtxWriter.Write((int16_t)std::stoi(split2[1], nullptr, 10)); // v.y
-								vtxWriter.Write((int16_t)std::stoi(split2[2], nullptr, 10)); // v.z
+							vtxWriter.Write(BitConverter::ToInt16BE(rawData, vtxOffset + 0)); // v.x
+							vtxWriter.Write(BitConverter::ToInt16BE(rawData, vtxOffset + 2)); // v.y
+							vtxWriter.Write(BitConverter::ToInt16BE(rawData, vtxOffset + 4)); // v.z
 
-								vtxWriter.Write((int16_t)0);								 // v.flag
+							vtxWriter.Write((int16_t)0);								 // v.flag
 
-								vtxWriter.Write((int16_t)std::stoi(split2[3], nullptr, 10)); // v.s
-								vtxWriter.Write((int16_t)std::stoi(split2[4], nullptr, 10)); // v.t
+							vtxWriter.Write(BitConverter::ToInt16BE(rawData, vtxOffset + 8)); // v.s
+							vtxWriter.Write(BitConverter::ToInt16BE(rawData, vtxOffset + 10)); // v.t
 
-								vtxWriter.Write((uint8_t)std::stoi(split2[5], nullptr, 10)); // v.r
-								vtxWriter.Write((uint8_t)std::stoi(split2[6], nullptr, 10)); // v.g
-								vtxWriter.Write((uint8_t)std::stoi(split2[7], nullptr, 10)); // v.b
-								vtxWriter.Write((uint8_t)std::stoi(split2[8], nullptr, 10)); // v.a
-							}
+							vtxWriter.Write(rawData[vtxOffset + 12]); // v.r
+							vtxWriter.Write(rawData[vtxOffset + 13]); // v.g
+							vtxWriter.Write(rawData[vtxOffset + 14]); // v.b
+							vtxWriter.Write(rawData[vtxOffset + 15]); // v.a
 						}
 
 						AddFile(fName, vtxStream->ToVector());
-
-						auto end = std::chrono::steady_clock::now();
-						size_t diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 					}
 				}
 				else
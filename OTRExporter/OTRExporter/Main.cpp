@@ -17,12 +17,15 @@
 #include "BlobExporter.h"
 #include "MtxExporter.h"
 #include "AudioExporter.h"
+#include "BuildCache.h"
 #include <Globals.h>
 #include <Utils/File.h>
 #include <Utils/Directory.h>
 #include <Utils/MemoryStream.h>
 #include <Utils/BinaryWriter.h>
+#include <ctpl_stl.h>
 #include <bit>
+#include <future>
 #include <mutex>
 
 std::string otrFileName = "oot.otr";
@@ -62,6 +65,54 @@ static void ExporterParseFileMode(const std::string& buildMode, ZFileMode& fileM
 	}
 }
 
+struct ExtractFileEntry
+{
+	std::string name;
+	std::vector<uint8_t> data;
+};
+
+// Reads (and if needed converts) a loose file from the Extract directory into the form it is
+// stored in the archive. Returns an entry with an empty name if the file should be skipped.
+static ExtractFileEntry PrepareExtractFile(const std::string& item)
+{
+	std::vector<std::string> splitPath = StringHelper::Split(item, ".");
+
+	if (splitPath.size() >= 3) {
+		std::string extension = splitPath.at(splitPath.size() - 1);
+		std::string format = splitPath.at(splitPath.size() - 2);
+		splitPath.pop_back();
+		splitPath.pop_back();
+		std::string afterPath = std::accumulate(splitPath.begin(), splitPath.end(), std::string(""));
+		if (extension == "png" && (format == "rgba32" || format == "rgb5a1" || format == "i4" || format == "i8" || format == "ia4" || format == "ia8" || format == "ia16" || format == "ci4" || format == "ci8")) {
+			ZTexture tex(nullptr);
+			tex.FromPNG(item, ZTexture::GetTextureTypeFromString(format));
+
+			OTRExporter_Texture exporter;
+			MemoryStream* stream = new MemoryStream();
+			BinaryWriter writer(stream);
+
+			exporter.Save(&tex, "", &writer);
+
+			std::string src = tex.GetBodySourceCode();
+			writer.Write((char*) src.c_str(), src.size());
+
+			std::vector<char> fileData = stream->ToVector();
+			return { StringHelper::Split(afterPath, "Extract/assets/")[1], std::vector<uint8_t>(fileData.begin(), fileData.end()) };
+		}
+	}
+
+	if (item.find("accessibility") != std::string::npos) {
+		std::string extension = splitPath.at(splitPath.size() - 1);
+		if (extension == "json") {
+			printf("Adding accessibility texts %s\n", StringHelper::Split(item, "texts/")[1].c_str());
+			return { StringHelper::Split(item, "Extract/assets/")[1], File::ReadAllBytes(item) };
+		}
+		return {};
+	}
+
+	return { StringHelper::Split(item, item.find("Extract/assets/") != std::string::npos ? "Extract/assets/" : "Extract/")[1], File::ReadAllBytes(item) };
+}
+
 static void ExporterProgramEnd()
 {
 	if (Globals::Instance->fileMode == ZFileMode::ExtractDirectory)
@@ -90,11 +141,29 @@ static void ExporterProgramEnd()
 		printf("Created version file.\n");
 
 		printf("Generating OTR Archive...\n");
+		fflush(stdout);
 		otrArchive = Ship::Archive::CreateArchive(otrFileName, 40000);
 
-		for (auto item : files) {
+		// Loose files from the Extract directory (custom textures, accessibility texts...) are read
+		// and converted on a worker pool while the extracted resources are being written below.
+		// The archive itself is only touched from this thread, and the results are appended in
+		// directory listing order so the output does not depend on thread timing.
+		auto lst = Directory::ListFiles("Extract");
+		const int numThreads = std::thread::hardware_concurrency();
+		ctpl::thread_pool pool(numThreads > 1 ? numThreads / 2 : 1);
+		std::vector<std::future<ExtractFileEntry>> extractFutures;
+		extractFutures.reserve(lst.size());
+
+		Globals::Instance->buildRawTexture = true;
+
+		for (const auto& item : lst)
+			extractFutures.push_back(pool.push([item](int) { return PrepareExtractFile(item); }));
+
+		const bool isMQ = Globals::Instance->rom->IsMQ();
+
+		for (const auto& item : files) {
 			std::string fName = item.first;
-			if (fName.find("gTitleZeldaShieldLogoMQTex") != std::string::npos && !ZRom(romPath).IsMQ())
+			if (!isMQ && fName.find("gTitleZeldaShieldLogoMQTex") != std::string::npos)
 			{
 				size_t pos = 0;
 				if ((pos = fName.find("gTitleZeldaShieldLogoMQTex", 0)) != std::string::npos)
@@ -102,59 +171,21 @@ static void ExporterProgramEnd()
 					fName.replace(pos, 27, "gTitleZeldaShieldLogoTex");
 				}
 			}
-			auto fileData = item.second;
+			const auto& fileData = item.second;
 			otrArchive->AddFile(fName, (uintptr_t)fileData.data(),
 		                      fileData.size());
 		}
 
 		// Add any additional files that need to be manually copied...
-		auto lst = Directory::ListFiles("Extract");
-
-		for (auto item : lst)
+		for (auto& future : extractFutures)
 		{
-			std::vector<std::string> splitPath = StringHelper::Split(item, ".");
-
-			if (splitPath.size() >= 3) {
-				std::string extension = splitPath.at(splitPath.size() - 1);
-				std::string format = splitPath.at(splitPath.size() - 2);
-				splitPath.pop_back();
-				splitPath.pop_back();
-				std::string afterPath = std::accumulate(splitPath.begin(), splitPath.end(), std::string(""));
-				if (extension == "png" && (format == "rgba32" || format == "rgb5a1" || format == "i4" || format == "i8" || format == "ia4" || format == "ia8" || format == "ia16" || format == "ci4" || format == "ci8")) {
-					ZTexture tex(nullptr);
-					Globals::Instance->buildRawTexture = true;
-					tex.FromPNG(item, ZTexture::GetTextureTypeFromString(format));
-					printf("otrArchive->AddFile(%s)\n", StringHelper::Split(afterPath, "Extract/")[1].c_str());
-
-					auto exporter = new OTRExporter_Texture();
-					MemoryStream* stream = new MemoryStream();
-					BinaryWriter writer(stream);
-
- 					exporter->Save(&tex, "", &writer);
-
- 					std::string src = tex.GetBodySourceCode();
- 					writer.Write((char*) src.c_str(), src.size());
-
- 					std::vector<char> fileData = stream->ToVector();
- 					otrArchive->AddFile(StringHelper::Split(afterPath, "Extract/assets/")[1], (uintptr_t)fileData.data(), fileData.size());
-					continue;
-				}
-			}
+			ExtractFileEntry entry = future.get();
 
-			if(item.find("accessibility") != std::string::npos) {
-				std::string extension = splitPath.at(splitPath.size() - 1);
-				splitPath.pop_back();
-				if(extension == "json"){
-					auto fileData = File::ReadAllBytes(item);
-					printf("Adding accessibility texts %s\n", StringHelper::Split(item, "texts/")[1].c_str());
-					otrArchive->AddFile(StringHelper::Split(item, "Extract/assets/")[1], (uintptr_t)fileData.data(), fileData.size());
-				}
+			if (entry.name.empty())
 				continue;
-			}
 
-			auto fileData = File::ReadAllBytes(item);
-			printf("otrArchive->AddFile(%s)\n", StringHelper::Split(item, "Extract/")[1].c_str());
-			otrArchive->AddFile(StringHelper::Split(item, item.find("Extract/assets/") != std::string::npos ? "Extract/assets/" : "Extract/")[1], (uintptr_t)fileData.data(), fileData.size());
+			printf("otrArchive->AddFile(%s)\n", entry.name.c_str());
+			otrArchive->AddFile(entry.name, (uintptr_t)entry.data.data(), entry.data.size());
 		}
 	}
 }
@@ -169,6 +200,11 @@ static void ExporterParseArgs(int argc, char* argv[], int& i)
 		otrFileName = argv[i + 1];
 		i++;
 	}
+	else if (arg == "--cache")
+	{
+		BuildCache_SetDirectory(argv[i + 1]);
+		i++;
+	}
 }
 
 static bool ExporterProcessFileMode(ZFileMode fileMode)
@@ -233,8 +269,11 @@ static void ExporterResourceEnd(ZResource* res, BinaryWriter& writer)
 
 		if (Globals::Instance->fileMode == ZFileMode::ExtractDirectory)
 		{
+			std::vector<char> fileData = strem->ToVector();
+			BuildCache_Record(fName, fileData);
+
 			std::unique_lock Lock(fileMutex);
-			files[fName] = strem->ToVector();
+			files[fName] = std::move(fileData);
 		}
 		else
 			File::WriteAllBytes("Extract/" + fName, strem->ToVector());
@@ -261,11 +300,30 @@ void AddFile(std::string fName, std::vector<char> data)
 		File::WriteAllBytes("Extract/" + fName, data);
 	else
 	{
+		BuildCache_Record(fName, data);
+
 		std::unique_lock Lock(fileMutex);
-		files[fName] = data;
+		files[fName] = std::move(data);
 	}
 }
 
+// Whether a resource has already been exported, either into the in-memory file list or to the Extract directory.
+bool HasFile(const std::string& fName)
+{
+	{
+		std::unique_lock Lock(fileMutex);
+		auto it = files.find(fName);
+		if (it != files.end())
+		{
+			// Usually exported by another XML. Record it anyway so a cached XML brings along everything it references.
+			BuildCache_Record(fName, it->second);
+			return true;
+		}
+	}
+
+	return File::Exists("Extract/" + fName);
+}
+
 static void ImportExporters()
 {
 	// In this example we set up a new exporter called "EXAMPLE".
@@ -280,6 +338,8 @@ static void ImportExporters()
 	exporterSet->endXMLFunc = ExporterXMLEnd;
 	exporterSet->resSaveFunc = ExporterResourceEnd;
 	exporterSet->endProgramFunc = ExporterProgramEnd;
+	exporterSet->beginExtractFunc = BuildCache_Begin;
+	exporterSet->endExtractFunc = BuildCache_End;
 
 	exporterSet->exporters[ZResourceType::Background] = new OTRExporter_Background();
 	exporterSet->exporters[ZResourceType::Texture] = new OTRExporter_Texture();
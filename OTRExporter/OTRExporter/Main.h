@@ -5,4 +5,5 @@
 extern std::shared_ptr<Ship::Archive> otrArchive;
 extern std::map<std::string, std::vector<char>> files;
 
-void AddFile(std::string fName, std::vector<char> data);
\ No newline at end of file
+void AddFile(std::string fName, std::vector<char> data);
+bool HasFile(const std::string& fName);
\ No newline at end of file
@@ -8,7 +8,7 @@ import struct
 import subprocess
 import argparse
 
-def BuildOTR(xmlPath, rom, zapd_exe=None):
+def BuildOTR(xmlPath, rom, zapd_exe=None, cache_dir=None):
     shutil.copytree("assets", "Extract/assets")
 
     if not zapd_exe:
@@ -19,6 +19,9 @@ def BuildOTR(xmlPath, rom, zapd_exe=None):
             "-rconf", "CFG/Config.xml", "-se", "OTR", "--otrfile", 
             "oot-mq.otr" if Z64Rom.isMqRom(rom) else "oot.otr"]
 
+    if cache_dir:
+        exec_cmd += ["--cache", cache_dir]
+
     print(exec_cmd)
     exitValue = subprocess.call(exec_cmd)
     if exitValue != 0:
@@ -32,6 +35,7 @@ def main():
     parser.add_argument("-z", "--zapd", help="Path to ZAPD executable", dest="zapd_exe", type=str)
     parser.add_argument("rom", help="Path to the rom", type=str, nargs="?")
     parser.add_argument("--non-interactive", help="Runs the script non-interactively for use in build scripts.", dest="non_interactive", action="store_true")
+    parser.add_argument("--cache", help="Directory to keep exported resources in between builds, so unchanged XMLs are not extracted again", dest="cache_dir", type=str)
     parser.add_argument("-v", "--verbose", help="Display rom's header checksums and their corresponding xml folder", dest="verbose", action="store_true")
 
     args = parser.parse_args()
@@ -41,7 +45,7 @@ def main():
         if (os.path.exists("Extract")):
             shutil.rmtree("Extract")
 
-        BuildOTR("../soh/assets/xml/" + rom.version.xml_ver + "/", rom.file_path, zapd_exe=args.zapd_exe)
+        BuildOTR("../soh/assets/xml/" + rom.version.xml_ver + "/", rom.file_path, zapd_exe=args.zapd_exe, cache_dir=args.cache_dir)
 
 if __name__ == "__main__":
     main()
@@ -2,6 +2,7 @@
 #include "raymath.h"
 #include "utils/rutils.h"
 #define RLIGHTS_IMPLEMENTATION
+#include <mutex>
 #include <thread>
 
 #include "impl.h"
@@ -28,6 +29,8 @@ RomVersion version;
 const char* patched_rom = "tmp/rom.z64";
 extern bool oldExtractMode;
 
+// Written by the extraction threads, read by the render thread
+static std::mutex currentStepMutex;
 static std::string currentStep = "None";
 
 void OTRGame::preload() {
@@ -109,7 +112,7 @@ void OTRGame::update(){
 	SetShaderValue(shader, shader.locs[SHADER_LOC_VECTOR_VIEW], cameraPos, SHADER_UNIFORM_VEC3);
 
 	if(!extracting && sohFolder != NULLSTR && rom_ready) {
-		currentStep = "Extracting rom assets";
+		setCurrentStep("Extracting rom assets");
 		ExtractRom();
 	}
 }
@@ -119,6 +122,7 @@ void OTRGame::draw() {
 	Rectangle titlebar = Rectangle(0, 0, windowSize.x - 50, 35);
 	Vector2 mousePos = GetMousePosition();
 	Vector2 mouseDelta = GetMouseDelta();
+	const std::string step = getCurrentStep();
 
 	if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) && !isDragging &&
 		mousePos.x >= titlebar.x && mousePos.y >= titlebar.y && mousePos.x <= titlebar.x + titlebar.width && mousePos.y <= titlebar.y + titlebar.height) {
@@ -167,7 +171,7 @@ void OTRGame::draw() {
 	Texture2D titleTex = Textures["Title"];
 	DrawTexture(titleTex, windowSize.x / 2 - titleTex.width / 2, titlebar.height / 2 - titleTex.height / 2, WHITE);
 
-	if (UIUtils::GuiIcon("Exit", windowSize.x - 36, titlebar.height / 2 - 10) && (extracting && currentStep.find("Done") != std::string::npos || !extracting)) {
+	if (UIUtils::GuiIcon("Exit", windowSize.x - 36, titlebar.height / 2 - 10) && (extracting && step.find("Done") != std::string::npos || !extracting)) {
 		closeRequested = true;
 	}
 
@@ -181,14 +185,14 @@ void OTRGame::draw() {
 	UIUtils::GuiShadowText("OTR Version: 1.0", 32, text_y + 30, 10, WHITE, BLACK);
 
 	if (oldExtractMode)
-		UIUtils::GuiToggle(&single_thread, "Single Thread", 32, text_y + 40, currentStep != NULLSTR);
+		UIUtils::GuiToggle(&single_thread, "Single Thread", 32, text_y + 40, step != NULLSTR);
 
-	if (!hide_second_btn && UIUtils::GuiIconButton("Folder", "Open\nShip Folder", 109, 50, currentStep != NULLSTR, "Select your Ship of Harkinian Folder\n\nYou could use another folder\nfor development purposes")) {
+	if (!hide_second_btn && UIUtils::GuiIconButton("Folder", "Open\nShip Folder", 109, 50, step != NULLSTR, "Select your Ship of Harkinian Folder\n\nYou could use another folder\nfor development purposes")) {
 		const std::string path = NativeFS->LaunchFileExplorer(LaunchType::FOLDER);
 		sohFolder = path;
 	}
 
-	if (UIUtils::GuiIconButton("Cartridge", "Open\nOoT Rom", 32, 50, currentStep != NULLSTR, "Select an Ocarina of Time\nGameCube PAL or Vanilla Debug Rom\n\nYou can dump it or lend one from Nintendo")) {
+	if (UIUtils::GuiIconButton("Cartridge", "Open\nOoT Rom", 32, 50, step != NULLSTR, "Select an Ocarina of Time\nGameCube PAL or Vanilla Debug Rom\n\nYou can dump it or lend one from Nintendo")) {
 		const std::string path = NativeFS->LaunchFileExplorer(LaunchType::FILE);
 		if (path != NULLSTR) {
 			const std::string patched_n64 = std::string(patched_rom);
@@ -205,19 +209,25 @@ void OTRGame::draw() {
 		}
 	}
 
-	if (currentStep != NULLSTR) {
+	if (step != NULLSTR) {
 		DrawRectangle(0, 0, windowSize.x, windowSize.y, Color(0, 0, 0, 160));
 		DrawTexture(Textures["Modal"], windowSize.x / 2 - Textures["Modal"].width / 2, windowSize.y / 2 - Textures["Modal"].height / 2, WHITE);
-		UIUtils::GuiShadowText(currentStep.c_str(), 0, windowSize.y / 2, 10, WHITE, BLACK, windowSize.x, true);
+		UIUtils::GuiShadowText(step.c_str(), 0, windowSize.y / 2, 10, WHITE, BLACK, windowSize.x, true);
 	}
 
 	EndDrawing();
 }
 
 void setCurrentStep(const std::string& step) {
+	std::lock_guard<std::mutex> lock(currentStepMutex);
 	currentStep = step;
 }
 
+std::string getCurrentStep() {
+	std::lock_guard<std::mutex> lock(currentStepMutex);
+	return currentStep;
+}
+
 void OTRGame::exit(){
 
 }
@@ -4,4 +4,5 @@
 extern FSBridge* NativeFS;
 extern bool single_thread;
 
-void setCurrentStep(const std::string& step);
\ No newline at end of file
+void setCurrentStep(const std::string& step);
+std::string getCurrentStep();
\ No newline at end of file
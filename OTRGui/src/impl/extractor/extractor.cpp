@@ -4,6 +4,8 @@
 #include "impl.h"
 #include "utils/mutils.h"
 #include "ctpl/ctpl_stl.h"
+#include <atomic>
+#include <sstream>
 #include <thread>
 #include <impl/baserom_extractor/baserom_extractor.h>
 
@@ -15,8 +17,8 @@
 namespace Util = MoonUtils;
 
 bool oldExtractMode = false;
-static int maxResources = 0;
-static int extractedResources = 0;
+static std::atomic<int> maxResources(0);
+static std::atomic<int> extractedResources(0);
 bool buildingOtr = false;
 int skipFrames = 0;
 
@@ -122,26 +124,46 @@ void startWorker(RomVersion version) {
 	}
 	else
 	{
-		std::string otrExporterArgs = Util::format("--otrfile %s", version.isMQ ? "oot-mq.otr" : "oot.otr");
-		std::string execStr = Util::format("assets/extractor/%s", isWindows() ? "ZAPD.exe" : "ZAPD.out");
-		std::string args = Util::format(" ed -eh -i %s -b tmp/rom.z64 -fl assets/extractor/filelists -o %s -osf %s -gsf 1 -rconf assets/extractor/Config_%s.xml -se OTR %s", path.c_str(), (path + "/../").c_str(), (path + "/../").c_str(), GetXMLVersion(version).c_str(), otrExporterArgs.c_str());
-		ProcessResult result = NativeFS->LaunchProcess(execStr + args);
+		maxResources = 1;
 
-		if (result.exitCode != 0) {
-			std::cout << "\nError when extracting the ROM with error code: " << result.exitCode << " !" << std::endl;
-			std::cout << "Aborting...\n" << std::endl;
-		}
-		else
-		{
-			printf("All done?\n");
-		}
+		// ZAPD runs on its own thread so the window keeps drawing, and reports each finished XML
+		// on stdout so we can show how far along it is.
+		std::thread zapd([path, version]() {
+			std::string otrExporterArgs = Util::format("--otrfile %s", version.isMQ ? "oot-mq.otr" : "oot.otr");
+			std::string execStr = Util::format("assets/extractor/%s", isWindows() ? "ZAPD.exe" : "ZAPD.out");
+			std::string args = Util::format(" ed -eh -i %s -b tmp/rom.z64 -fl assets/extractor/filelists -o %s -osf %s -gsf 1 -rconf assets/extractor/Config_%s.xml -se OTR %s --progress", path.c_str(), (path + "/../").c_str(), (path + "/../").c_str(), GetXMLVersion(version).c_str(), otrExporterArgs.c_str());
+			ProcessResult result = NativeFS->LaunchProcess(execStr + args, [](const std::string& line) {
+				std::cout << line << std::endl;
+
+				if (line.rfind("PROGRESS ", 0) == 0) {
+					std::istringstream progress(line.substr(9));
+					int done, total;
+					std::string file;
+					if (progress >> done >> total && std::getline(progress >> std::ws, file)) {
+						setCurrentStep(Util::format("Extracting (%d/%d): %s", done, total, Util::basename(file).c_str()));
+					}
+				} else if (line.rfind("Generating OTR Archive", 0) == 0) {
+					setCurrentStep("Building OTR...");
+				}
+			});
+
+			if (result.exitCode != 0) {
+				std::cout << "\nError when extracting the ROM with error code: " << result.exitCode << " !" << std::endl;
+				std::cout << "Aborting...\n" << std::endl;
+			}
+			else
+			{
+				printf("All done?\n");
+			}
 
-		maxResources = 1;
+			extractedResources++;
+		});
+		zapd.detach();
 	}
 }
 
 void updateWorker(const std::string& output, RomVersion version) {
-	if (maxResources > 0 && !buildingOtr && (extractedResources >= maxResources || !oldExtractMode)) 
+	if (maxResources > 0 && !buildingOtr && extractedResources >= maxResources) 
 	{
 		setCurrentStep("Building OTR...");
 		if (skipFrames < 3) {
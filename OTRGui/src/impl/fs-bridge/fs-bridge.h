@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <string>
 
 #define NULLSTR "None"
@@ -15,6 +16,7 @@ struct ProcessResult {
 class FSBridge {
 public:
 	virtual void InitBridge() = 0;
-	virtual ProcessResult LaunchProcess(std::string cmd) = 0;
+	// If onOutputLine is set, the process's stdout is captured and passed to it one line at a time
+	virtual ProcessResult LaunchProcess(std::string cmd, std::function<void(const std::string&)> onOutputLine = nullptr) = 0;
 	virtual std::string LaunchFileExplorer(LaunchType type) = 0;
 };
\ No newline at end of file
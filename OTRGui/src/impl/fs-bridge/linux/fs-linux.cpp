@@ -9,11 +9,35 @@
 
 void LinuxBridge::InitBridge() {}
 
-ProcessResult LinuxBridge::LaunchProcess(std::string cmd) {
+ProcessResult LinuxBridge::LaunchProcess(std::string cmd, std::function<void(const std::string&)> onOutputLine) {
     cmd = MoonUtils::normalize(cmd);
     std::cout << "Trying to launch: " << cmd << std::endl;
     ProcessResult result = { };
-    result.exitCode = WEXITSTATUS(system(cmd.c_str()));
+
+    if (onOutputLine == nullptr) {
+        result.exitCode = WEXITSTATUS(system(cmd.c_str()));
+        return result;
+    }
+
+    FILE* pipe = popen(cmd.c_str(), "r");
+    if (pipe == nullptr) {
+        result.exitCode = -1;
+        return result;
+    }
+
+    std::string line;
+    char buffer[512];
+    while (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
+        line += buffer;
+        if (line.back() == '\n') {
+            line.pop_back();
+            onOutputLine(line);
+            line.clear();
+        }
+    }
+    if (!line.empty()) onOutputLine(line);
+
+    result.exitCode = WEXITSTATUS(pclose(pipe));
     return result;
 }
 
@@ -9,7 +9,7 @@
 
 void WindowsBridge::InitBridge() {}
 
-ProcessResult WindowsBridge::LaunchProcess(std::string cmd) {
+ProcessResult WindowsBridge::LaunchProcess(std::string cmd, std::function<void(const std::string&)> onOutputLine) {
     cmd = MoonUtils::normalize(cmd);
     std::cout << "Trying to launch: " << cmd << std::endl;
     ProcessResult result = { };
@@ -21,6 +21,23 @@ ProcessResult WindowsBridge::LaunchProcess(std::string cmd) {
     si.cb = sizeof(si);
     ZeroMemory(&pi, sizeof(pi));
 
+    // Redirect the child's stdout into a pipe we can read from
+    HANDLE outRead = NULL;
+    HANDLE outWrite = NULL;
+    if (onOutputLine != nullptr) {
+        SECURITY_ATTRIBUTES sa = { sizeof(SECURITY_ATTRIBUTES), NULL, TRUE };
+        if (!CreatePipe(&outRead, &outWrite, &sa, 0)) {
+            result.exitCode = GetLastError();
+            return result;
+        }
+        SetHandleInformation(outRead, HANDLE_FLAG_INHERIT, 0);
+
+        si.dwFlags |= STARTF_USESTDHANDLES;
+        si.hStdOutput = outWrite;
+        si.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+        si.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+    }
+
     char cwd[256];
     getcwd(cwd, 256);
 
@@ -29,7 +46,7 @@ ProcessResult WindowsBridge::LaunchProcess(std::string cmd) {
         LPSTR(cmd.c_str()),   // Command line
         NULL,           // Process handle not inheritable
         NULL,           // Thread handle not inheritable
-        FALSE,          // Set handle inheritance to FALSE
+        outWrite != NULL, // Inherit the stdout pipe if we are capturing output
         0,              // No creation flags
         NULL,           // Use parent's environment block
         NULL,           // Use parent's starting directory
@@ -37,9 +54,35 @@ ProcessResult WindowsBridge::LaunchProcess(std::string cmd) {
         &pi
     )) {
         result.exitCode = GetLastError();
+        if (outWrite != NULL) {
+            CloseHandle(outRead);
+            CloseHandle(outWrite);
+        }
         return result;
     }
 
+    if (outWrite != NULL) {
+        // Only the child should hold the write end, otherwise ReadFile never sees the end of the pipe
+        CloseHandle(outWrite);
+
+        std::string line;
+        char buffer[512];
+        DWORD bytesRead;
+        while (ReadFile(outRead, buffer, sizeof(buffer), &bytesRead, NULL) && bytesRead > 0) {
+            for (DWORD i = 0; i < bytesRead; i++) {
+                if (buffer[i] == '\n') {
+                    if (!line.empty() && line.back() == '\r') line.pop_back();
+                    onOutputLine(line);
+                    line.clear();
+                } else {
+                    line += buffer[i];
+                }
+            }
+        }
+        if (!line.empty()) onOutputLine(line);
+        CloseHandle(outRead);
+    }
+
     // Wait until child process exits.
     WaitForSingleObject(pi.hProcess, INFINITE);
     GetExitCodeProcess(pi.hProcess, &exit_code);
@@ -4,6 +4,6 @@
 
 class WindowsBridge : public FSBridge {
 	void InitBridge() override;
-	ProcessResult LaunchProcess(std::string cmd) override;
+	ProcessResult LaunchProcess(std::string cmd, std::function<void(const std::string&)> onOutputLine = nullptr) override;
 	std::string LaunchFileExplorer(LaunchType type) override;
 };
\ No newline at end of file
@@ -23,6 +23,8 @@ typedef void (*ExporterSetFuncVoid)(int argc, char* argv[], int& i);
 typedef void (*ExporterSetFuncVoid2)(const std::string& buildMode, ZFileMode& fileMode);
 typedef void (*ExporterSetFuncVoid3)();
 typedef void (*ExporterSetResSave)(ZResource* res, BinaryWriter& writer);
+typedef bool (*ExporterSetFuncBool2)(const std::string& xmlPath);
+typedef void (*ExporterSetFuncVoid4)(const std::string& xmlPath, bool success);
 
 class ExporterSet
 {
@@ -38,6 +40,8 @@ public:
 	ExporterSetFuncVoid3 beginXMLFunc = nullptr;
 	ExporterSetFuncVoid3 endXMLFunc = nullptr;
 	ExporterSetResSave resSaveFunc = nullptr;
+	ExporterSetFuncBool2 beginExtractFunc = nullptr;  // Return true if the XML doesn't need extracting
+	ExporterSetFuncVoid4 endExtractFunc = nullptr;
 	ExporterSetFuncVoid3 endProgramFunc = nullptr;
 };
 
@@ -65,6 +69,9 @@ public:
 	bool forceUnaccountedStatic = false;
 	bool otrMode = true;
 	bool buildRawTexture = false;
+	int numThreads = 0;  // Worker threads used by ExtractDirectory, 0 uses every core
+	fs::path timingsPath;  // If set, per-file extraction times are written here as CSV
+	bool reportProgress = false;  // Print a machine-readable line as each file finishes
 
 	ZRom* rom;
 	std::vector<ZFile*> files;
@@ -24,6 +24,10 @@
 #include <string_view>
 #include "tinyxml2.h"
 #include <ctpl_stl.h>
+#include <algorithm>
+#include <fstream>
+#include <future>
+#include <mutex>
 
 //extern const char gBuildHash[];
 const char gBuildHash[] = "";
@@ -61,7 +65,15 @@ void BuildAssetBackground(const fs::path& imageFilePath, const fs::path& outPath
 void BuildAssetBlob(const fs::path& blobFilePath, const fs::path& outPath);
 int ExtractFunc(int workerID, int fileListSize, std::string fileListItem, ZFileMode fileMode);
 
-volatile int numWorkersLeft = 0;
+struct ExtractTiming
+{
+	std::string file;
+	uintmax_t estimatedCost;
+	int64_t milliseconds;
+};
+
+std::mutex extractTimingsMutex;
+std::vector<ExtractTiming> extractTimings;
 
 #ifdef __linux__
 #define ARRAY_COUNT(arr) (sizeof(arr) / sizeof(arr[0]))
@@ -260,6 +272,18 @@ int main(int argc, char* argv[])
 		{
 			Globals::Instance->buildRawTexture = true;
 		}
+		else if (arg == "-j" || arg == "--jobs")  // Number of extraction threads (0 = all cores)
+		{
+			Globals::Instance->numThreads = std::max(0, atoi(argv[++i]));
+		}
+		else if (arg == "--timings")  // Write per-file extraction times to a CSV file
+		{
+			Globals::Instance->timingsPath = argv[++i];
+		}
+		else if (arg == "--progress")  // Report "PROGRESS <done> <total> <file>" lines on stdout
+		{
+			Globals::Instance->reportProgress = true;
+		}
 	}
 
 	// Parse File Mode
@@ -327,8 +351,10 @@ int main(int argc, char* argv[])
 				std::vector<std::string> fileList =
 					Directory::ListFiles(Globals::Instance->inputPath.string());
 
-				const int num_threads = std::thread::hardware_concurrency();
-				ctpl::thread_pool pool(num_threads > 1 ? num_threads / 2 : 1);
+				int num_threads = Globals::Instance->numThreads;
+				if (num_threads <= 0)
+					num_threads = std::max(1u, std::thread::hardware_concurrency());
+				ctpl::thread_pool pool(num_threads);
 
 				bool parseSuccessful;
 
@@ -339,39 +365,84 @@ int main(int argc, char* argv[])
 				for (int i = 0; i < fileListSize; i++)
 					Globals::Instance->workerData[i] = new FileWorker();
 
-				numWorkersLeft = fileListSize;
+				// The pool hands out work in submission order, so queue the most expensive files
+				// first to keep a few big scenes from being the tail of the run. The XML size is
+				// a cheap stand-in for how much a file will extract.
+				std::vector<std::pair<uintmax_t, int>> fileCosts;
+				fileCosts.reserve(fileListSize);
 
 				for (int i = 0; i < fileListSize; i++)
 				{
-					if (Globals::Instance->singleThreaded)
-					{
-						ExtractFunc(i, fileList.size(), fileList[i], fileMode);
-					}
-					else
-					{
-						std::string fileListItem = fileList[i];
-						pool.push([i, fileListSize, fileListItem, fileMode](int) {
-							ExtractFunc(i, fileListSize, fileListItem, fileMode);
-						});
-					}
+					std::error_code ec;
+					uintmax_t cost = fs::file_size(fileList[i], ec);
+					fileCosts.push_back({ ec ? 0 : cost, i });
 				}
 
-				if (!Globals::Instance->singleThreaded)
-				{
-					while (true)
-					{
-						if (numWorkersLeft <= 0)
-							break;
+				std::stable_sort(fileCosts.begin(), fileCosts.end(),
+				                 [](const auto& a, const auto& b) { return a.first > b.first; });
 
-						std::this_thread::sleep_for(std::chrono::milliseconds(250));
-					}
+				std::vector<std::future<int>> results;
+				results.reserve(fileListSize);
+
+				for (const auto& [cost, i] : fileCosts)
+				{
+					std::string fileListItem = fileList[i];
+					results.push_back(pool.push([i, cost, fileListSize, fileListItem, fileMode, exporterSet](int) {
+						auto fileStart = std::chrono::steady_clock::now();
+						int result = 0;
+
+						// The exporter may already have the output of this XML from a previous run
+						if (exporterSet != nullptr && exporterSet->beginExtractFunc != nullptr &&
+						    exporterSet->beginExtractFunc(fileListItem))
+						{
+							printf("(%i / %i): %s (cached)\n", (i + 1), fileListSize, fileListItem.c_str());
+						}
+						else
+						{
+							result = ExtractFunc(i, fileListSize, fileListItem, fileMode);
+
+							if (exporterSet != nullptr && exporterSet->endExtractFunc != nullptr)
+								exporterSet->endExtractFunc(fileListItem, result == 0);
+						}
+
+						auto fileEnd = std::chrono::steady_clock::now();
+
+						std::unique_lock lock(extractTimingsMutex);
+						extractTimings.push_back(
+							{ fileListItem, cost,
+						      std::chrono::duration_cast<std::chrono::milliseconds>(fileEnd - fileStart)
+						          .count() });
+
+						if (Globals::Instance->reportProgress)
+						{
+							printf("PROGRESS %zu %i %s\n", extractTimings.size(), fileListSize,
+							       fileListItem.c_str());
+							fflush(stdout);
+						}
+						return result;
+					}));
 				}
 
+				for (auto& result : results)
+					result.wait();
+
 				auto end = std::chrono::steady_clock::now();
 				auto diff =
 					std::chrono::duration_cast<std::chrono::seconds>(end - start).count();
 
 				printf("Generated OTR File Data in %i seconds\n", diff);
+
+				if (!Globals::Instance->timingsPath.empty())
+				{
+					std::sort(extractTimings.begin(), extractTimings.end(),
+					          [](const auto& a, const auto& b) { return a.milliseconds > b.milliseconds; });
+
+					std::ofstream timingsFile(Globals::Instance->timingsPath);
+					timingsFile << "file,estimated_cost,milliseconds\n";
+
+					for (const auto& timing : extractTimings)
+						timingsFile << timing.file << "," << timing.estimatedCost << "," << timing.milliseconds << "\n";
+				}
  			}
 			else
 			{
@@ -479,8 +550,6 @@ int ExtractFunc(int workerID, int fileListSize, std::string fileListItem, ZFileM
 		Globals::Instance->workerData[workerID]->externalFiles.clear();
 		Globals::Instance->workerData[workerID]->segments.clear();
 		Globals::Instance->workerData[workerID]->segmentRefFiles.clear();
-
-		numWorkersLeft--;
 	}
 	return 0;
 }
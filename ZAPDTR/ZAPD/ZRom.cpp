@@ -192,8 +192,6 @@ ZRom::ZRom(std::string romPath)
 	auto txt = File::ReadAllText(path);
 	std::vector<std::string> lines = StringHelper::Split(txt, "\n");
 
-    std::vector<uint8_t> decompressedData(1);
-
 	for (int i = 0; i < lines.size(); i++)
 	{
 		lines[i] = StringHelper::Strip(lines[i], "\r");
@@ -205,28 +203,38 @@ ZRom::ZRom(std::string romPath)
 		const int physEnd = BitConverter::ToInt32BE(romData, romOffset + 12);
 
 		const bool compressed = physEnd != 0;
-		int size = compressed ? physEnd - physStart : virtEnd - virtStart;
 
-		auto outData = std::vector<uint8_t>();
-		outData.resize(size);
-		memcpy(outData.data(), romData.data() + physStart, size);
+		// Decompression is deferred to GetFile, so files ZAPD never asks for are never
+		// decoded and the ones it does ask for are decoded on the worker threads that need them.
+		ZRomFile& file = files[lines[i]];
+		file.physStart = physStart;
+		file.physSize = compressed ? physEnd - physStart : virtEnd - virtStart;
+		file.virtSize = virtEnd - virtStart;
+		file.compressed = compressed;
+	}
+}
+
+const std::vector<uint8_t>& ZRom::GetFile(const std::string& fileName)
+{
+	static const std::vector<uint8_t> emptyFile;
+
+	auto it = files.find(fileName);
+	if (it == files.end())
+		return emptyFile;
 
-		if (compressed)
+	ZRomFile& file = it->second;
+
+	std::call_once(file.loadFlag, [this, &file]() {
+		const uint8_t* src = romData.data() + file.physStart;
+
+		if (file.compressed)
 		{
-			int decSize = virtEnd - virtStart;
-			decompressedData = std::vector<uint8_t>();
-			decompressedData.resize(decSize);
-			yaz0_decode(outData.data(), decompressedData.data(), decSize);
-			files[lines[i]] = decompressedData;
+			file.data.resize(file.virtSize);
+			yaz0_decode(src, file.data.data(), file.virtSize);
 		}
 		else
-			files[lines[i]] = outData;
-
-		//File::WriteAllBytes(StringHelper::Sprintf("baserom/%s", lines[i].c_str()), files[lines[i]]);
-	}
-}
+			file.data.assign(src, src + file.physSize);
+	});
 
-std::vector<uint8_t> ZRom::GetFile(std::string fileName)
-{
-	return files[fileName];
+	return file.data;
 }
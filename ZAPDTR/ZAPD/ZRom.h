@@ -3,19 +3,34 @@
 #include <stdint.h>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <string>
 
+// A file from the ROM's DMA table. Its contents are only copied out (and decompressed if
+// needed) the first time it is requested.
+struct ZRomFile
+{
+	uint32_t physStart = 0;
+	uint32_t physSize = 0;
+	uint32_t virtSize = 0;
+	bool compressed = false;
+
+	std::once_flag loadFlag;
+	std::vector<uint8_t> data;
+};
+
 class ZRom
 {
 public:
 	ZRom(std::string romPath);
 
-	std::vector<uint8_t> GetFile(std::string fileName);
+	// Safe to call from multiple threads. The returned reference stays valid for the lifetime of the ZRom.
+	const std::vector<uint8_t>& GetFile(const std::string& fileName);
     bool IsMQ();
 
 protected:
 	std::vector<uint8_t> romData;
-	std::map<std::string, std::vector<uint8_t>> files;
+	std::map<std::string, ZRomFile> files;
 };
 
 struct RomVersion
@@ -2,7 +2,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <list>
+#include <algorithm>
 #include "readwrite.h"
 
 #include "yaz0.h"
@@ -11,8 +11,15 @@ typedef uint8_t u8;
 typedef uint16_t u16;
 typedef uint32_t u32;
 
+#define YAZ0_WINDOW_SIZE 0x1000
+#define YAZ0_MIN_MATCH 3
+#define YAZ0_MAX_MATCH 0x111
+
+#define YAZ0_HASH_BITS 15
+#define YAZ0_HASH_SIZE (1 << YAZ0_HASH_BITS)
+
 /* internal declarations */
-int yaz0_encode_internal(const u8* src, int srcSize, u8* Data);
+int yaz0_encode_internal(const u8* src, int srcSize, u8* Data, int effort);
 
 int yaz0_get_size(u8* src) { return U32(src + 0x4); }
 
@@ -24,73 +31,61 @@ u32 toDWORD(u32 d) {
   return (w1 << 24) | (w2 << 16) | (w3 << 8) | w4;
 }
 
-// simple and straight encoding scheme for Yaz0
-u32 longest_match_brute(const u8* src, int size, int pos, u32* pMatchPos) {
-  int startPos = pos - 0x1000;
-  int max_match_size = size - pos;
-  u32 best_match_size = 0;
-  u32 best_match_pos = 0;
+static inline u32 yaz0_hash(const u8* p) {
+  u32 v = p[0] << 16 | p[1] << 8 | p[2];
+  return (v * 0x9E3779B1u) >> (32 - YAZ0_HASH_BITS);
+}
 
-  if (max_match_size < 3) return 0;
+// Hash chain match finder. head holds the most recent position for each hash of three bytes,
+// prev links every position in the window to the previous one with the same hash.
+struct Yaz0MatchFinder {
+  std::vector<int32_t> head;
+  std::vector<int32_t> prev;
 
-  if (startPos < 0) startPos = 0;
+  Yaz0MatchFinder() : head(YAZ0_HASH_SIZE, -1), prev(YAZ0_WINDOW_SIZE, -1) {
+  }
 
-  if (max_match_size > 0x111) max_match_size = 0x111;
+  void insert(const u8* src, int size, int pos) {
+    if (pos + YAZ0_MIN_MATCH > size) return;
 
-  for (int i = startPos; i < pos; i++) {
-    int current_size;
-    for (current_size = 0; current_size < max_match_size; current_size++) {
-      if (src[i + current_size] != src[pos + current_size]) {
-	break;
-      }
-    }
-    if (current_size > best_match_size) {
-      best_match_size = current_size;
-      best_match_pos = i;
-      if (best_match_size == 0x111) break;
-    }
+    u32 h = yaz0_hash(src + pos);
+    prev[pos & (YAZ0_WINDOW_SIZE - 1)] = head[h];
+    head[h] = pos;
   }
-  *pMatchPos = best_match_pos;
-  return best_match_size;
-}
 
-u32 longest_match_rabinkarp(const u8* src, int size, int pos, u32* match_pos) {
-  int startPos = pos - 0x1000;
-  int max_match_size = size - pos;
-  u32 best_match_size = 0;
-  u32 best_match_pos = 0;
+  // Returns the longest match for pos among the previously inserted positions, following at most
+  // maxChain candidates. The nearest of equally long matches wins.
+  u32 longest_match(const u8* src, int size, int pos, int maxChain, u32* pMatchPos) const {
+    int max_match_size = std::min(size - pos, YAZ0_MAX_MATCH);
+    u32 best_match_size = 0;
+    u32 best_match_pos = 0;
 
-  if (max_match_size < 3) return 0;
+    if (max_match_size < YAZ0_MIN_MATCH) return 0;
 
-  if (startPos < 0) startPos = 0;
+    int candidate = head[yaz0_hash(src + pos)];
 
-  if (max_match_size > 0x111) max_match_size = 0x111;
+    while (candidate >= 0 && pos - candidate <= YAZ0_WINDOW_SIZE && maxChain-- > 0) {
+      if (src[candidate + best_match_size] == src[pos + best_match_size]) {
+        int current_size = 0;
+        while (current_size < max_match_size && src[candidate + current_size] == src[pos + current_size])
+          current_size++;
 
-  int find_hash = src[pos] << 16 | src[pos + 1] << 8 | src[pos + 2];
-  int current_hash = src[startPos] << 16 | src[startPos + 1] << 8 | src[startPos + 2];
-
-  for (int i = startPos; i < pos; i++) {
-    if(current_hash == find_hash) {
-      int current_size;
-      for (current_size = 3; current_size < max_match_size; current_size++) {
-        if (src[i + current_size] != src[pos + current_size]) {
-          break;
+        if (current_size > (int)best_match_size) {
+          best_match_size = current_size;
+          best_match_pos = candidate;
+          if (current_size == max_match_size) break;
         }
       }
-      if (current_size > best_match_size) {
-        best_match_size = current_size;
-        best_match_pos = i;
-        if (best_match_size == 0x111) break;
-      }
+
+      candidate = prev[candidate & (YAZ0_WINDOW_SIZE - 1)];
     }
-    current_hash = (current_hash << 8 | src[i + 3]) & 0xFFFFFF;
-  }
-  *match_pos = best_match_pos;
 
-  return best_match_size;
-}
+    *pMatchPos = best_match_pos;
+    return best_match_size >= YAZ0_MIN_MATCH ? best_match_size : 0;
+  }
+};
 
-int yaz0_encode_internal(const u8* src, int srcSize, u8* Data) {
+int yaz0_encode_internal(const u8* src, int srcSize, u8* Data, int effort) {
   int srcPos = 0;
 
   int bitmask = 0x80;
@@ -98,14 +93,15 @@ int yaz0_encode_internal(const u8* src, int srcSize, u8* Data) {
   int currCodeBytePos = 0;
   int pos = currCodeBytePos + 1;
 
+  Yaz0MatchFinder finder;
+
   while (srcPos < srcSize) {
     u32 numBytes;
     u32 matchPos;
 
-    numBytes = longest_match_rabinkarp(src, srcSize, srcPos, &matchPos);
-    //fprintf(stderr, "pos %x len %x pos %x\n", srcPos, (int)numBytes, (int)matchPos);
+    numBytes = finder.longest_match(src, srcSize, srcPos, effort, &matchPos);
     if (numBytes < 3) {
-      //fprintf(stderr, "single byte %02x\n", src[srcPos]);
+      finder.insert(src, srcSize, srcPos);
       Data[pos++] = src[srcPos++];
       currCodeByte |= bitmask;
     } else {
@@ -123,6 +119,9 @@ int yaz0_encode_internal(const u8* src, int srcSize, u8* Data) {
         Data[pos++] = ((numBytes - 2) << 4) | (dist >> 8);
         Data[pos++] = dist & 0xFF;
       }
+
+      for (u32 i = 0; i < numBytes; i++)
+        finder.insert(src, srcSize, srcPos + i);
       srcPos += numBytes;
     }
     bitmask >>= 1;
@@ -142,20 +141,10 @@ int yaz0_encode_internal(const u8* src, int srcSize, u8* Data) {
   return pos;
 }
 
-std::vector<uint8_t> yaz0_encode_fast(const u8* src, int src_size) {
-  std::vector<uint8_t> buffer;
-  std::vector<std::list<uint32_t>> lut;
-  lut.resize(0x1000000);
-
-  for (int i = 0; i < src_size - 3; ++i) {
-    lut[src[i + 0] << 16 | src[i + 1] << 8 | src[i + 2]].push_back(i);
-  }
-
-  return buffer;
-}
-
-std::vector<uint8_t> yaz0_encode(const u8* src, int src_size) {
-  std::vector<uint8_t> buffer(src_size * 10 / 8 + 16);
+std::vector<uint8_t> yaz0_encode(const u8* src, int src_size, int effort) {
+  // 16 byte header, then one code byte per eight literals in the worst case, plus the code byte the
+  // encoder opens after the last group
+  std::vector<uint8_t> buffer(16 + src_size + (src_size + 7) / 8 + 1);
   u8* dst = buffer.data();
 
   // write 4 bytes yaz0 header
@@ -165,7 +154,7 @@ std::vector<uint8_t> yaz0_encode(const u8* src, int src_size) {
   W32(dst + 4, src_size);
 
   // encode
-  int dst_size = yaz0_encode_internal(src, src_size, dst + 16);
+  int dst_size = yaz0_encode_internal(src, src_size, dst + 16, std::max(effort, 1));
   int aligned_size = (dst_size + 31) & -16;
   buffer.resize(aligned_size);
 
@@ -181,47 +170,77 @@ std::vector<uint8_t> yaz0_encode(const u8* src, int src_size) {
 }
 
 void yaz0_decode(const uint8_t* source, uint8_t* decomp, int32_t decompSize) {
-  uint32_t srcPlace = 0, dstPlace = 0;
-  uint32_t i, dist, copyPlace, numBytes;
-  uint8_t codeByte, byte1, byte2;
+  const uint8_t* src = source + 0x10;
+  uint8_t* dst = decomp;
+  uint8_t* const dstEnd = decomp + decompSize;
+  uint32_t dist, numBytes;
+  uint8_t codeByte = 0, byte1, byte2;
   uint8_t bitCount = 0;
 
-  source += 0x10;
-  while (dstPlace < decompSize) {
+  while (dst < dstEnd) {
     /* If there are no more bits to test, get a new byte */
     if (!bitCount) {
-      codeByte = source[srcPlace++];
+      codeByte = *src++;
       bitCount = 8;
+
+      /* Eight literals in a row can be copied in one go */
+      if (codeByte == 0xFF && dstEnd - dst >= 8) {
+        memcpy(dst, src, 8);
+        dst += 8;
+        src += 8;
+        bitCount = 0;
+        continue;
+      }
     }
 
     /* If bit 7 is a 1, just copy 1 byte from source to destination */
     /* Else do some decoding */
     if (codeByte & 0x80) {
-      decomp[dstPlace++] = source[srcPlace++];
+      *dst++ = *src++;
     } else {
       /* Get 2 bytes from source */
-      byte1 = source[srcPlace++];
-      byte2 = source[srcPlace++];
+      byte1 = *src++;
+      byte2 = *src++;
 
       /* Calculate distance to move in destination */
       /* And the number of bytes to copy */
-      dist = ((byte1 & 0xF) << 8) | byte2;
-      copyPlace = dstPlace - (dist + 1);
+      dist = (((byte1 & 0xF) << 8) | byte2) + 1;
       numBytes = byte1 >> 4;
 
       /* Do more calculations on the number of bytes to copy */
       if (!numBytes)
-        numBytes = source[srcPlace++] + 0x12;
+        numBytes = *src++ + 0x12;
       else
         numBytes += 2;
 
+      numBytes = std::min<uint32_t>(numBytes, dstEnd - dst);
+
       /* Copy data from a previous point in destination */
-      /* to current point in destination */
-      for (i = 0; i < numBytes; i++) decomp[dstPlace++] = decomp[copyPlace++];
+      /* to current point in destination. When the copy overlaps itself the data */
+      /* repeats every dist bytes, so copy it one period at a time. */
+      if (dist >= 8 && dstEnd - dst >= numBytes + 8) {
+        /* Word at a time, may write up to 7 bytes past the copy which get overwritten later */
+        uint8_t* copyEnd = dst + numBytes;
+        while (dst < copyEnd) {
+          memcpy(dst, dst - dist, 8);
+          dst += 8;
+        }
+        dst = copyEnd;
+      } else if (dist == 1) {
+        memset(dst, dst[-1], numBytes);
+        dst += numBytes;
+      } else {
+        while (numBytes > 0) {
+          uint32_t chunk = std::min(numBytes, dist);
+          memcpy(dst, dst - dist, chunk);
+          dst += chunk;
+          numBytes -= chunk;
+        }
+      }
     }
 
     /* Set up for the next read cycle */
     codeByte = codeByte << 1;
     bitCount--;
   }
-}
\ No newline at end of file
+}
@@ -1,6 +1,13 @@
 #pragma once
 
+#include <stdint.h>
 #include <vector>
 
+// Number of match candidates the encoder examines per position. YAZ0_EFFORT_MAX searches the whole
+// window, lower values trade compression ratio for speed.
+#define YAZ0_EFFORT_FAST 16
+#define YAZ0_EFFORT_DEFAULT 256
+#define YAZ0_EFFORT_MAX 0x1000
+
 void yaz0_decode(const uint8_t* src, uint8_t* dest, int32_t destsize);
-std::vector<uint8_t> yaz0_encode(const uint8_t* src, int src_size);
\ No newline at end of file
+std::vector<uint8_t> yaz0_encode(const uint8_t* src, int src_size, int effort = YAZ0_EFFORT_MAX);
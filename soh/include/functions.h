@@ -221,6 +221,7 @@ void EffectSs_InitInfo(PlayState* play, s32 tableSize);
 void EffectSs_ClearAll(PlayState* play);
 void EffectSs_Delete(EffectSs* effectSs);
 void EffectSs_Reset(EffectSs* effectSs);
+void EffectSs_ResyncSlots(void);
 void EffectSs_Insert(PlayState* play, EffectSs* effectSs);
 void EffectSs_Spawn(PlayState* play, s32 type, s32 priority, void* initParams);
 void EffectSs_UpdateAll(PlayState* play);
@@ -582,6 +583,7 @@ s32 BgCheck_CheckLineAgainstSSList(SSList* headNodeId, CollisionContext* colCtx,
                                    f32 chkDist, s32 bccFlags);
 void BgCheck_GetStaticLookupIndicesFromPos(CollisionContext* colCtx, Vec3f* pos, Vec3i* arg2);
 void BgCheck_Allocate(CollisionContext* colCtx, PlayState* play, CollisionHeader* colHeader);
+void BgCheck_CompactStaticLookup(CollisionContext* colCtx, StaticLookup* lookupTbl);
 s32 BgCheck_PosInStaticBoundingBox(CollisionContext* colCtx, Vec3f* pos);
 f32 BgCheck_EntityRaycastFloor1(CollisionContext* colCtx, CollisionPoly** outPoly, Vec3f* pos);
 f32 BgCheck_EntityRaycastFloor2(PlayState* play, CollisionContext* colCtx, CollisionPoly** outPoly,
@@ -1018,6 +1020,7 @@ void ZeldaArena_FreeDebug(void* ptr, const char* file, s32 line);
 void* ZeldaArena_Calloc(size_t num, size_t size);
 void ZeldaArena_Display();
 void ZeldaArena_GetSizes(u32* outMaxFree, u32* outFree, u32* outAlloc);
+void ZeldaArena_GetStats(ZeldaArenaStats* stats);
 void ZeldaArena_Check();
 void ZeldaArena_Init(void* start, size_t size);
 void ZeldaArena_Cleanup();
@@ -1078,13 +1078,21 @@ typedef struct {
 typedef struct {
     /* 0x000 */ s16 colATCount;
     /* 0x002 */ u16 sacFlags;
-    /* 0x004 */ Collider* colAT[COLLISION_CHECK_AT_MAX];
+    /* 0x004 */ Collider* colATBuffer[COLLISION_CHECK_AT_MAX];
     /* 0x0CC */ s32 colACCount;
-    /* 0x0D0 */ Collider* colAC[COLLISION_CHECK_AC_MAX];
+    /* 0x0D0 */ Collider* colACBuffer[COLLISION_CHECK_AC_MAX];
     /* 0x1C0 */ s32 colOCCount;
-    /* 0x1C4 */ Collider* colOC[COLLISION_CHECK_OC_MAX];
+    /* 0x1C4 */ Collider* colOCBuffer[COLLISION_CHECK_OC_MAX];
     /* 0x28C */ s32 colLineCount;
     /* 0x290 */ OcLine* colLine[COLLISION_CHECK_OC_LINE_MAX];
+    // The collider lists in use. They point at the buffers above unless "gRaiseColliderLimits" made them grow into
+    // the zelda arena
+    Collider** colAT;
+    Collider** colAC;
+    Collider** colOC;
+    s32 colATCapacity;
+    s32 colACCapacity;
+    s32 colOCCapacity;
 } CollisionCheckContext; // size = 0x29C
 
 typedef struct ListAlloc {
@@ -1932,6 +1940,27 @@ typedef struct ArenaNode {
     ///* 0x28 */ u8 unk_28[0x30-0x28]; // probably padding
 } ArenaNode; // size = 0x10
 
+typedef struct {
+    // Arena
+    u32 freeBlocks;   // number of free nodes in the arena
+    u32 largestFree;  // size of the largest free node
+    u32 totalFree;    // combined size of all free nodes
+    u32 totalAlloc;   // combined size of all allocated nodes, including the size-class pool
+    f32 fragmentation; // 1 - largestFree / totalFree, 0 when all free memory is one block
+    // Size-class pool, see ZeldaArena_Init
+    u8 poolEnabled;
+    u32 poolPages;
+    u32 poolPagesUsed;
+    u32 poolBlocksUsed;
+    u32 poolBytesUsed; // size-class bytes handed out, including rounding up to the class size
+    // Counters since ZeldaArena_Init
+    u32 poolAllocs;
+    u32 arenaAllocs;
+    u32 failedAllocs;
+    u32 lastFailedSize;
+    u32 lastFailedLargestFree; // largestFree at the time of the last failure
+} ZeldaArenaStats;
+
 typedef struct OverlayRelocationSection {
     /* 0x00 */ u32 textSize;
     /* 0x04 */ u32 dataSize;
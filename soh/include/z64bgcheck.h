@@ -128,6 +128,22 @@ typedef struct {
     SSList floor;
 } DynaLookup;
 
+// The SSNodes built for a BgActor whose transform didn't change. While the actor stays put and everything before it
+// in the dyna lists keeps the same size, the nodes from the previous DynaPoly_Setup are still valid and are reused.
+typedef struct {
+    u8 valid;
+    u16 noCeiling; // bgActorFlags & 8 when the nodes were built
+    u16 polyStartIndex;
+    u16 vtxStartIndex;
+    s32 nodeStartIndex;
+    s32 nodeCount;
+    u32 setupCount; // DynaCollisionContext setupCount when the nodes were built or last reused
+    CollisionHeader* colHeader;
+    SSList ceiling;
+    SSList wall;
+    SSList floor;
+} DynaLookupCache;
+
 typedef struct {
     /* 0x00 */ struct Actor* actor;
     /* 0x04 */ CollisionHeader* colHeader;
@@ -138,7 +154,8 @@ typedef struct {
     /* 0x54 */ Sphere16 boundingSphere;
     /* 0x5C */ f32 minY;
     /* 0x60 */ f32 maxY;
-} BgActor; // size = 0x64
+    DynaLookupCache lookupCache;
+} BgActor;
 
 typedef struct {
     /* 0x0000 */ u8 bitFlag;
@@ -150,7 +167,8 @@ typedef struct {
     /* 0x1404 */ s32 polyNodesMax;
     /* 0x1408 */ s32 polyListMax;
     /* 0x140C */ s32 vtxListMax;
-} DynaCollisionContext; // size = 0x1410
+    u32 setupCount; // number of DynaPoly_Setup calls since the context was initialized
+} DynaCollisionContext;
 
 typedef struct CollisionContext {
     /* 0x00 */ CollisionHeader* colHeader; // scene's static collision
@@ -233,6 +233,10 @@ typedef struct EffectSs {
     u32 epoch;
 } EffectSs; // size = 0x60
 
+#define EFFECT_SS_TABLE_SIZE 0x55
+// Upper bound for "gEffectSsTableSize", which can raise the table size above the original
+#define EFFECT_SS_TABLE_SIZE_MAX 0x400
+
 typedef struct {
     /* 0x00 */ EffectSs* table; // "data_table"
     /* 0x04 */ s32 searchStartIndex;
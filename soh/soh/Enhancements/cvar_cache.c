@@ -0,0 +1,11 @@
+#include "cvar_cache.h"
+
+// Starts at 1 so zero-initialized handles are stale on their first read
+uint32_t gCVarCacheGeneration = 1;
+
+void CVarCache_Invalidate(void) {
+    gCVarCacheGeneration++;
+    if (gCVarCacheGeneration == 0) {
+        gCVarCacheGeneration = 1;
+    }
+}
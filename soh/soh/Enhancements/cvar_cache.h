@@ -0,0 +1,40 @@
+#pragma once
+
+#include <libultraship/bridge.h>
+
+// An integer CVar read that is resolved once and reused until the cache generation changes. The generation
+// is bumped at the start of every frame, so changes made from the menus or the console are picked up on the
+// next frame without hashing the CVar name on every call. Declare one as a static next to the hot read:
+//
+//     static CVarCachedInt sDisableDrawDistance = CVAR_CACHED_INT("gDisableDrawDistance", 0);
+//     if (CVarCache_GetInteger(&sDisableDrawDistance) != 0) { ... }
+//
+// Only use this for CVars the game code itself doesn't change mid-frame.
+typedef struct {
+    const char* name;
+    int32_t defaultValue;
+    int32_t value;
+    uint32_t generation;
+} CVarCachedInt;
+
+#define CVAR_CACHED_INT(name, defaultValue) { name, defaultValue, defaultValue, 0 }
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern uint32_t gCVarCacheGeneration;
+
+void CVarCache_Invalidate(void);
+
+static inline int32_t CVarCache_GetInteger(CVarCachedInt* cvar) {
+    if (cvar->generation != gCVarCacheGeneration) {
+        cvar->value = CVarGetInteger(cvar->name, cvar->defaultValue);
+        cvar->generation = gCVarCacheGeneration;
+    }
+    return cvar->value;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -459,6 +459,32 @@ static bool QuitHandler(std::shared_ptr<Ship::Console> Console, const std::vecto
     return CMD_SUCCESS;
 }
 
+static bool ArenaStatsHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args) {
+    if (gPlayState == nullptr) {
+        SohImGui::GetConsole()->SendErrorMessage("gPlayState == nullptr");
+        return CMD_FAILED;
+    }
+
+    ZeldaArenaStats stats;
+    ZeldaArena_GetStats(&stats);
+    SohImGui::GetConsole()->SendInfoMessage("[SOH] Zelda arena: %u bytes allocated, %u bytes free in %u blocks",
+                                            stats.totalAlloc, stats.totalFree, stats.freeBlocks);
+    SohImGui::GetConsole()->SendInfoMessage("[SOH] Largest free block: %u bytes, fragmentation: %.1f%%",
+                                            stats.largestFree, stats.fragmentation * 100.0f);
+    if (stats.poolEnabled) {
+        SohImGui::GetConsole()->SendInfoMessage("[SOH] Size-class pool: %u/%u pages, %u blocks, %u bytes in use",
+                                                stats.poolPagesUsed, stats.poolPages, stats.poolBlocksUsed,
+                                                stats.poolBytesUsed);
+    }
+    SohImGui::GetConsole()->SendInfoMessage("[SOH] Allocations: %u from the pool, %u from the arena, %u failed",
+                                            stats.poolAllocs, stats.arenaAllocs, stats.failedAllocs);
+    if (stats.failedAllocs != 0) {
+        SohImGui::GetConsole()->SendInfoMessage("[SOH] Last failure: %u bytes requested, largest free block was %u",
+                                                stats.lastFailedSize, stats.lastFailedLargestFree);
+    }
+    return CMD_SUCCESS;
+}
+
 static bool SaveStateHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args) {
     unsigned int slot = OTRGlobals::Instance->gSaveStateMgr->GetCurrentSlot();
     const SaveStateReturn rtn = OTRGlobals::Instance->gSaveStateMgr->AddRequest({ slot, RequestType::SAVE });
@@ -494,6 +520,23 @@ static bool LoadStateHandler(std::shared_ptr<Ship::Console> Console, const std::
 
 }
 
+static bool RewindHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args) {
+    const SaveStateReturn rtn = OTRGlobals::Instance->gSaveStateMgr->AddRequest({ 0, RequestType::REWIND });
+
+    switch (rtn) {
+        case SaveStateReturn::SUCCESS:
+            SohImGui::GetConsole()->SendInfoMessage("[SOH] Rewinding");
+            return CMD_SUCCESS;
+        case SaveStateReturn::FAIL_STATE_EMPTY:
+            SohImGui::GetConsole()->SendErrorMessage("[SOH] Nothing to rewind, enable gRewindEnabled first");
+            return CMD_FAILED;
+        case SaveStateReturn::FAIL_WRONG_GAMESTATE:
+            SohImGui::GetConsole()->SendErrorMessage("[SOH] Can not rewind outside of \"GamePlay\"");
+            return CMD_FAILED;
+    }
+    return CMD_FAILED;
+}
+
 static bool StateSlotSelectHandler(std::shared_ptr<Ship::Console> Console, const std::vector<std::string>& args) {
     if (args.size() != 2) {
         SohImGui::GetConsole()->SendErrorMessage("[SOH] Unexpected arguments passed");
@@ -1313,10 +1356,12 @@ void DebugConsole_Init(void) {
     CMD_REGISTER("file_select", { FileSelectHandler, "Returns to the file select." });
     CMD_REGISTER("reset", { ResetHandler, "Resets the game." });
     CMD_REGISTER("quit", { QuitHandler, "Quits the game." });
+    CMD_REGISTER("arena_stats", { ArenaStatsHandler, "Shows the actor heap's usage and fragmentation." });
 
     // Save States
     CMD_REGISTER("save_state", { SaveStateHandler, "Save a state." });
     CMD_REGISTER("load_state", { LoadStateHandler, "Load a state." });
+    CMD_REGISTER("rewind", { RewindHandler, "Rewind to the last captured state." });
     CMD_REGISTER("set_slot", { StateSlotSelectHandler, "Selects a SaveState slot", {
         { "Slot number", Ship::ArgumentType::NUMBER, }
     }});
@@ -615,7 +615,9 @@ static void AssumedFill(const std::vector<uint32_t>& items, const std::vector<ui
             ItemTable(item).SetAsPlaythrough();
             itemsToPlace.pop_back();
 
-            // assume we have all unplaced items
+            // assume we have all unplaced items. The search below starts over from the root for every placement:
+            // taking an item out of the assumed set can only shrink what is reachable, and the access conditions
+            // don't expose which items they read, so the previous search can't be pruned to what this item opened
             LogicReset();
             for (uint32_t unplacedItem : itemsToPlace) {
                 ItemTable(unplacedItem).ApplyEffect();
@@ -371,7 +371,7 @@ void AreaTable_Init() {
 
 namespace Areas {
 
-  const auto GetAllAreas() {
+  const std::array<uint32_t, MARKER_AREAS_END - (MARKER_AREAS_START + 1)>& GetAllAreas() {
     static const size_t areaCount = MARKER_AREAS_END - (MARKER_AREAS_START + 1);
 
     static std::array<uint32_t, areaCount> allAreas = {};
@@ -667,6 +667,9 @@ namespace Logic {
   }
 
   //Updates all logic helpers. Should be called whenever a non-helper is changed
+  //The result depends on the previous call: CanStunDeku reads HasShield before it is reassigned, and
+  //helpers such as MasterSword or the unshuffled trade items stay set once set. Calls can therefore
+  //not be skipped or shared between age/time checks without changing the generated seeds.
   void UpdateHelpers() {
     NumBottles      = ((NoBottles) ? 0 : (Bottles + ((DeliverLetter) ? 1 : 0)));
     HasBottle       = NumBottles >= 1;
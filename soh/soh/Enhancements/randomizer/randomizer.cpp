@@ -2,6 +2,7 @@
 #include <nlohmann/json.hpp>
 #include "3drando/settings.hpp"
 #include <fstream>
+#include <filesystem>
 #include <variables.h>
 #include <macros.h>
 #include <objects/gameplay_keep/gameplay_keep.h>
@@ -36,7 +37,7 @@ using namespace std::literals::string_literals;
 
 std::unordered_map<std::string, RandomizerCheck> SpoilerfileCheckNameToEnum;
 std::unordered_map<std::string, RandomizerGet> SpoilerfileGetNameToEnum;
-std::multimap<std::tuple<s16, s16, s32>, RandomizerCheckObject> checkFromActorMultimap;
+std::multimap<std::tuple<s16, s16, s32>, RandomizerCheckObject*> checkFromActorMultimap;
 std::set<RandomizerCheck> excludedLocations;
 
 u8 generated;
@@ -105,9 +106,9 @@ static const char* frenchRupeeNames[36] = {
 };
 
 Randomizer::Randomizer() {
-    for (auto [randomizerCheck, rcObject] : RandomizerCheckObjects::GetAllRCObjects()) {
+    for (auto& [randomizerCheck, rcObject] : RandomizerCheckObjects::GetAllRCObjects()) {
         SpoilerfileCheckNameToEnum[rcObject.rcSpoilerName] = rcObject.rc;
-        checkFromActorMultimap.emplace(std::make_tuple((s16)rcObject.actorId, (s16)rcObject.sceneId, rcObject.actorParams), rcObject);
+        checkFromActorMultimap.emplace(std::make_tuple((s16)rcObject.actorId, (s16)rcObject.sceneId, rcObject.actorParams), &rcObject);
     }
     SpoilerfileCheckNameToEnum["Invalid Location"] = RC_UNKNOWN_CHECK;
     SpoilerfileCheckNameToEnum["Link's Pocket"] = RC_LINKS_POCKET;
@@ -363,6 +364,28 @@ bool Randomizer::SpoilerFileExists(const char* spoilerFileName) {
 #pragma GCC pop_options
 #pragma optimize("", on)
 
+// Every Load* function below reads its own section out of the same spoiler file, so the parsed
+// document is kept around and only re-parsed when a different (or rewritten) file is requested.
+static std::string cachedSpoilerFilePath;
+static std::filesystem::file_time_type cachedSpoilerFileWriteTime;
+static json cachedSpoilerFileJson;
+
+static json& GetSpoilerFileJson(const std::string& spoilerFilePath, std::ifstream& spoilerFileStream) {
+    std::error_code ec;
+    std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(spoilerFilePath, ec);
+    if (!ec && spoilerFilePath == cachedSpoilerFilePath && writeTime == cachedSpoilerFileWriteTime) {
+        return cachedSpoilerFileJson;
+    }
+
+    cachedSpoilerFilePath.clear();
+    cachedSpoilerFileJson = json::parse(spoilerFileStream);
+    if (!ec) {
+        cachedSpoilerFilePath = spoilerFilePath;
+        cachedSpoilerFileWriteTime = writeTime;
+    }
+    return cachedSpoilerFileJson;
+}
+
 void Randomizer::LoadRandomizerSettings(const char* spoilerFileName) {
     if (strcmp(spoilerFileName, "") != 0) {
         ParseRandomizerSettingsFile(spoilerFileName);
@@ -629,7 +652,8 @@ void Randomizer::LoadMasterQuestDungeons(const char* spoilerFileName) {
 }
 
 void Randomizer::ParseRandomizerSettingsFile(const char* spoilerFileName) {
-    std::ifstream spoilerFileStream(sanitize(spoilerFileName));
+    std::string spoilerFilePath = sanitize(spoilerFileName);
+    std::ifstream spoilerFileStream(spoilerFilePath);
     if (!spoilerFileStream)
         return;
 
@@ -642,9 +666,8 @@ void Randomizer::ParseRandomizerSettingsFile(const char* spoilerFileName) {
             gSaveContext.randoSettings[i].value = 0;
         }
 
-        json spoilerFileJson;
-        spoilerFileStream >> spoilerFileJson;
-        json settingsJson = spoilerFileJson["settings"];
+        json& spoilerFileJson = GetSpoilerFileJson(spoilerFilePath, spoilerFileStream);
+        json& settingsJson = spoilerFileJson["settings"];
 
         for (auto it = settingsJson.begin(); it != settingsJson.end(); ++it) {
             // todo load into cvars for UI
@@ -1221,7 +1244,8 @@ std::string FormatJsonHintText(std::string jsonHint) {
 }
 
 void Randomizer::ParseHintLocationsFile(const char* spoilerFileName) {
-    std::ifstream spoilerFileStream(sanitize(spoilerFileName));
+    std::string spoilerFilePath = sanitize(spoilerFileName);
+    std::ifstream spoilerFileStream(spoilerFilePath);
     if (!spoilerFileStream)
         return;
 
@@ -1230,8 +1254,7 @@ void Randomizer::ParseHintLocationsFile(const char* spoilerFileName) {
     // Have all these use strncpy so that the null terminator is copied 
     // and also set the last index to null for safety
     try {
-        json spoilerFileJson;
-        spoilerFileStream >> spoilerFileJson;
+        json& spoilerFileJson = GetSpoilerFileJson(spoilerFilePath, spoilerFileStream);
 
         std::string childAltarJsonText = spoilerFileJson["childAltarText"].get<std::string>();
         std::string formattedChildAltarText = FormatJsonHintText(childAltarJsonText);
@@ -1287,7 +1310,7 @@ void Randomizer::ParseHintLocationsFile(const char* spoilerFileName) {
         strncpy(gSaveContext.warpPreludeText, warpPreludeJsonText.c_str(), sizeof(gSaveContext.warpPreludeText) - 1);
         gSaveContext.warpPreludeText[sizeof(gSaveContext.warpPreludeText) - 1] = 0;
 
-        json hintsJson = spoilerFileJson["hints"];
+        json& hintsJson = spoilerFileJson["hints"];
         int index = 0;
         for (auto it = hintsJson.begin(); it != hintsJson.end(); ++it) {
             gSaveContext.hintLocations[index].check = SpoilerfileCheckNameToEnum[it.key()];
@@ -1307,7 +1330,8 @@ void Randomizer::ParseHintLocationsFile(const char* spoilerFileName) {
 }
 
 void Randomizer::ParseRequiredTrialsFile(const char* spoilerFileName) {
-    std::ifstream spoilerFileStream(sanitize(spoilerFileName));
+    std::string spoilerFilePath = sanitize(spoilerFileName);
+    std::ifstream spoilerFileStream(spoilerFilePath);
     if (!spoilerFileStream) {
         return;
     }
@@ -1315,9 +1339,8 @@ void Randomizer::ParseRequiredTrialsFile(const char* spoilerFileName) {
     this->trialsRequired.clear();
 
     try {
-        json spoilerFileJson;
-        spoilerFileStream >> spoilerFileJson;
-        json trialsJson = spoilerFileJson["requiredTrials"];
+        json& spoilerFileJson = GetSpoilerFileJson(spoilerFilePath, spoilerFileStream);
+        json& trialsJson = spoilerFileJson["requiredTrials"];
 
         for (auto it = trialsJson.begin(); it != trialsJson.end(); it++) {
             this->trialsRequired[spoilerFileTrialToEnum[it.value()]] = true;
@@ -1328,7 +1351,8 @@ void Randomizer::ParseRequiredTrialsFile(const char* spoilerFileName) {
 }
 
 void Randomizer::ParseMasterQuestDungeonsFile(const char* spoilerFileName) {
-    std::ifstream spoilerFileStream(sanitize(spoilerFileName));
+    std::string spoilerFilePath = sanitize(spoilerFileName);
+    std::ifstream spoilerFileStream(spoilerFilePath);
     if (!spoilerFileStream) {
         return;
     }
@@ -1336,9 +1360,8 @@ void Randomizer::ParseMasterQuestDungeonsFile(const char* spoilerFileName) {
     this->masterQuestDungeons.clear();
 
     try {
-        json spoilerFileJson;
-        spoilerFileStream >> spoilerFileJson;
-        json mqDungeonsJson = spoilerFileJson["masterQuestDungeons"];
+        json& spoilerFileJson = GetSpoilerFileJson(spoilerFilePath, spoilerFileStream);
+        json& mqDungeonsJson = spoilerFileJson["masterQuestDungeons"];
 
         for (auto it = mqDungeonsJson.begin(); it != mqDungeonsJson.end(); it++) {
             this->masterQuestDungeons.emplace(spoilerFileDungeonToScene[it.value()]);
@@ -1408,17 +1431,17 @@ int16_t Randomizer::GetVanillaMerchantPrice(RandomizerCheck check) {
 }
 
 void Randomizer::ParseItemLocationsFile(const char* spoilerFileName, bool silent) {
-    std::ifstream spoilerFileStream(sanitize(spoilerFileName));
+    std::string spoilerFilePath = sanitize(spoilerFileName);
+    std::ifstream spoilerFileStream(spoilerFilePath);
     if (!spoilerFileStream)
         return;
 
     bool success = false;
 
     try {
-        json spoilerFileJson;
-        spoilerFileStream >> spoilerFileJson;
-        json locationsJson = spoilerFileJson["locations"];
-        json hashJson = spoilerFileJson["file_hash"];
+        json& spoilerFileJson = GetSpoilerFileJson(spoilerFilePath, spoilerFileStream);
+        json& locationsJson = spoilerFileJson["locations"];
+        json& hashJson = spoilerFileJson["file_hash"];
 
         int index = 0;
         for (auto it = hashJson.begin(); it != hashJson.end(); ++it) {
@@ -1429,7 +1452,7 @@ void Randomizer::ParseItemLocationsFile(const char* spoilerFileName, bool silent
         for (auto it = locationsJson.begin(); it != locationsJson.end(); ++it) {
             RandomizerCheck randomizerCheck = SpoilerfileCheckNameToEnum[it.key()];
             if (it->is_structured()) {
-                json itemJson = *it;
+                const json& itemJson = *it;
                 for (auto itemit = itemJson.begin(); itemit != itemJson.end(); ++itemit) {
                     if (itemit.key() == "item") {
                         gSaveContext.itemLocations[randomizerCheck].check = randomizerCheck;
@@ -1445,7 +1468,7 @@ void Randomizer::ParseItemLocationsFile(const char* spoilerFileName, bool silent
                     }
                 }
             } else {
-                gSaveContext.itemLocations[randomizerCheck].check = SpoilerfileCheckNameToEnum[it.key()];
+                gSaveContext.itemLocations[randomizerCheck].check = randomizerCheck;
                 gSaveContext.itemLocations[randomizerCheck].get.rgID = SpoilerfileGetNameToEnum[it.value()];
                 gSaveContext.itemLocations[randomizerCheck].get.fakeRgID = RG_NONE;
                 int16_t price = GetVanillaMerchantPrice(randomizerCheck);
@@ -1466,7 +1489,8 @@ void Randomizer::ParseItemLocationsFile(const char* spoilerFileName, bool silent
 }
 
 void Randomizer::ParseEntranceDataFile(const char* spoilerFileName, bool silent) {
-    std::ifstream spoilerFileStream(sanitize(spoilerFileName));
+    std::string spoilerFilePath = sanitize(spoilerFileName);
+    std::ifstream spoilerFileStream(spoilerFilePath);
     if (!spoilerFileStream) {
         return;
     }
@@ -1481,13 +1505,12 @@ void Randomizer::ParseEntranceDataFile(const char* spoilerFileName, bool silent)
     }
 
     try {
-        json spoilerFileJson;
-        spoilerFileStream >> spoilerFileJson;
-        json EntrancesJson = spoilerFileJson["entrances"];
+        json& spoilerFileJson = GetSpoilerFileJson(spoilerFilePath, spoilerFileStream);
+        json& EntrancesJson = spoilerFileJson["entrances"];
 
         size_t i = 0;
         for (auto it = EntrancesJson.begin(); it != EntrancesJson.end(); ++it, i++) {
-            json entranceJson = *it;
+            const json& entranceJson = *it;
 
             for (auto entranceIt = entranceJson.begin(); entranceIt != entranceJson.end(); ++entranceIt) {
                 if (entranceIt.key() == "index") {
@@ -2584,7 +2607,7 @@ std::map<RandomizerCheck, RandomizerInf> rcToRandomizerInf = {
 
 };
 
-RandomizerCheckObject Randomizer::GetCheckObjectFromActor(s16 actorId, s16 sceneNum, s32 actorParams = 0x00) {
+const RandomizerCheckObject& Randomizer::GetCheckObjectFromActor(s16 actorId, s16 sceneNum, s32 actorParams = 0x00) {
     RandomizerCheck specialRc = RC_UNKNOWN_CHECK;
     // TODO: Migrate these special cases into table, or at least document why they are special
     switch(sceneNum) {
@@ -2687,11 +2710,11 @@ RandomizerCheckObject Randomizer::GetCheckObjectFromActor(s16 actorId, s16 scene
 
     for (auto it = range.first; it != range.second; ++it) {
         if (
-            it->second.vOrMQ == RCVORMQ_BOTH ||
-            (it->second.vOrMQ == RCVORMQ_VANILLA && !ResourceMgr_IsGameMasterQuest()) ||
-            (it->second.vOrMQ == RCVORMQ_MQ && ResourceMgr_IsGameMasterQuest())
+            it->second->vOrMQ == RCVORMQ_BOTH ||
+            (it->second->vOrMQ == RCVORMQ_VANILLA && !ResourceMgr_IsGameMasterQuest()) ||
+            (it->second->vOrMQ == RCVORMQ_MQ && ResourceMgr_IsGameMasterQuest())
         ) {
-            return it->second;
+            return *it->second;
         }
     }
 
@@ -2714,7 +2737,7 @@ ScrubIdentity Randomizer::IdentifyScrub(s32 sceneNum, s32 actorParams, s32 respa
         actorParams = TWO_ACTOR_PARAMS(actorParams, respawnData);
     }
 
-    RandomizerCheckObject rcObject = GetCheckObjectFromActor(ACTOR_EN_DNS, sceneNum, actorParams);
+    const RandomizerCheckObject& rcObject = GetCheckObjectFromActor(ACTOR_EN_DNS, sceneNum, actorParams);
 
     if (rcObject.rc != RC_UNKNOWN_CHECK) {
         scrubIdentity.randomizerInf = rcToRandomizerInf[rcObject.rc];
@@ -2743,7 +2766,7 @@ ShopItemIdentity Randomizer::IdentifyShopItem(s32 sceneNum, u8 slotIndex) {
     shopItemIdentity.itemPrice = -1;
     shopItemIdentity.enGirlAShopItem = 0x32;
 
-    RandomizerCheckObject rcObject = GetCheckObjectFromActor(ACTOR_EN_GIRLA, 
+    const RandomizerCheckObject& rcObject = GetCheckObjectFromActor(ACTOR_EN_GIRLA, 
         // Bazaar (SHOP1) scene is reused, so if entering from Kak use debug scene to identify
         (sceneNum == SCENE_SHOP1 && gSaveContext.entranceIndex == 0xB7) ? SCENE_TEST01 : sceneNum, slotIndex);
 
@@ -2777,7 +2800,7 @@ CowIdentity Randomizer::IdentifyCow(s32 sceneNum, s32 posX, s32 posZ) {
         actorParams = TWO_ACTOR_PARAMS(posX, posZ);
     }
 
-    RandomizerCheckObject rcObject = GetCheckObjectFromActor(ACTOR_EN_COW, sceneNum, actorParams);
+    const RandomizerCheckObject& rcObject = GetCheckObjectFromActor(ACTOR_EN_COW, sceneNum, actorParams);
 
     if (rcObject.rc != RC_UNKNOWN_CHECK) {
         cowIdentity.randomizerInf = rcToRandomizerInf[rcObject.rc];
@@ -2841,12 +2864,20 @@ RandomizerInf Randomizer::GetRandomizerInfFromCheck(RandomizerCheck rc) {
     return rcIt->second;
 }
 
+static std::unordered_map<RandomizerInf, RandomizerCheck> randomizerInfToRc = {};
 RandomizerCheck Randomizer::GetCheckFromRandomizerInf(RandomizerInf randomizerInf) {
-    for (auto const& [key, value] : rcToRandomizerInf) {
-        if (value == randomizerInf) return key;
+    //memoize on first request
+    if (randomizerInfToRc.size() == 0) {
+        for (auto const& [key, value] : rcToRandomizerInf) {
+            randomizerInfToRc.emplace(value, key);
+        }
     }
 
-    return RC_UNKNOWN_CHECK;
+    auto rcIt = randomizerInfToRc.find(randomizerInf);
+    if (rcIt == randomizerInfToRc.end())
+        return RC_UNKNOWN_CHECK;
+
+    return rcIt->second;
 }
 
 std::thread randoThread;
@@ -3030,7 +3061,7 @@ void GenerateRandomizerImgui(std::string seed = "") {
     RandomizerCheckObjects::UpdateImGuiVisibility();
 
     // Remove excludes for locations that are no longer allowed to be excluded
-    for (auto [randomizerCheck, rcObject] : RandomizerCheckObjects::GetAllRCObjects()) {
+    for (auto& [randomizerCheck, rcObject] : RandomizerCheckObjects::GetAllRCObjects()) {
         auto elfound = excludedLocations.find(rcObject.rc);
         if (!rcObject.visibleInImgui && elfound != excludedLocations.end()) {
             excludedLocations.erase(elfound);
@@ -3046,8 +3077,18 @@ void GenerateRandomizerImgui(std::string seed = "") {
     generated = 1;
 }
 
+// Reaps the generation thread once it has finished, so that a new seed can be started.
+// randoThread is only ever touched from the main thread.
+static void JoinFinishedRandoThread() {
+    if (generated) {
+        generated = 0;
+        randoThread.join();
+    }
+}
+
 bool GenerateRandomizer(std::string seed /*= ""*/) {
-    if (CVarGetInteger("gRandoGenerating", 0) == 0) {
+    JoinFinishedRandoThread();
+    if (CVarGetInteger("gRandoGenerating", 0) == 0 && !randoThread.joinable()) {
         randoThread = std::thread(&GenerateRandomizerImgui, seed);
         return true;
     }
@@ -3055,10 +3096,7 @@ bool GenerateRandomizer(std::string seed /*= ""*/) {
 }
 
 void DrawRandoEditor(bool& open) {
-    if (generated) {
-        generated = 0;
-        randoThread.join();
-    }
+    JoinFinishedRandoThread();
 
     if (!open) {
         CVarSetInteger("gRandomizerSettingsEnabled", 0);
@@ -4325,7 +4363,7 @@ void DrawRandoEditor(bool& open) {
                 locationSearch.Draw();
 
                 ImGui::BeginChild("ChildIncludedLocations", ImVec2(0, -8));
-                for (auto [rcArea, rcObjects] : RandomizerCheckObjects::GetAllRCObjectsByArea()) {
+                for (auto& [rcArea, rcObjects] : RandomizerCheckObjects::GetAllRCObjectsByArea()) {
                     bool hasItems = false;
                     for (auto [randomizerCheck, rcObject] : rcObjects) {
                         if (rcObject->visibleInImgui && !excludedLocations.count(rcObject->rc) &&
@@ -4369,7 +4407,7 @@ void DrawRandoEditor(bool& open) {
                 window->DC.CurrLineTextBaseOffset = 0.0f;
 
                 ImGui::BeginChild("ChildExcludedLocations", ImVec2(0, -8));
-                for (auto [rcArea, rcObjects] : RandomizerCheckObjects::GetAllRCObjectsByArea()) {
+                for (auto& [rcArea, rcObjects] : RandomizerCheckObjects::GetAllRCObjectsByArea()) {
                     bool hasItems = false;
                     for (auto [randomizerCheck, rcObject] : rcObjects) {
                         if (rcObject->visibleInImgui && excludedLocations.count(rcObject->rc)) {
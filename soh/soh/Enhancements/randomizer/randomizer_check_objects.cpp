@@ -858,7 +858,7 @@ std::map<RandomizerCheckArea, std::string> rcAreaNames = {
 
 std::map<RandomizerCheckArea, std::map<RandomizerCheck, RandomizerCheckObject*>> rcObjectsByArea = {};
 
-std::map<RandomizerCheckArea, std::map<RandomizerCheck, RandomizerCheckObject*>> RandomizerCheckObjects::GetAllRCObjectsByArea() {
+std::map<RandomizerCheckArea, std::map<RandomizerCheck, RandomizerCheckObject*>>& RandomizerCheckObjects::GetAllRCObjectsByArea() {
     if (rcObjectsByArea.size() == 0) {
         for (auto& [randomizerCheck, rcObject] : rcObjects) {
             rcObjectsByArea[rcObject.rcArea][randomizerCheck] = &rcObject;
@@ -891,12 +891,12 @@ std::string RandomizerCheckObjects::GetRCAreaName(RandomizerCheckArea area) {
     return rcAreaNames[area];
 }
 
-std::map<RandomizerCheck, RandomizerCheckObject> RandomizerCheckObjects::GetAllRCObjects() {
+std::map<RandomizerCheck, RandomizerCheckObject>& RandomizerCheckObjects::GetAllRCObjects() {
     return rcObjects;
 }
 
 std::map<SceneID, RandomizerCheckArea> rcAreaBySceneID = {};
-std::map<SceneID, RandomizerCheckArea> RandomizerCheckObjects::GetAllRCAreaBySceneID() {
+std::map<SceneID, RandomizerCheckArea>& RandomizerCheckObjects::GetAllRCAreaBySceneID() {
     //memoize on first request
     if (rcAreaBySceneID.size() == 0) {
         for (auto& [randomizerCheck, rcObject] : rcObjects) {
@@ -911,7 +911,7 @@ std::map<SceneID, RandomizerCheckArea> RandomizerCheckObjects::GetAllRCAreaBySce
 }
 
 RandomizerCheckArea RandomizerCheckObjects::GetRCAreaBySceneID(SceneID sceneId) {
-    std::map<SceneID, RandomizerCheckArea> areas = GetAllRCAreaBySceneID();
+    std::map<SceneID, RandomizerCheckArea>& areas = GetAllRCAreaBySceneID();
     auto areaIt = areas.find(sceneId);
     if (areaIt == areas.end())
         return RCAREA_INVALID;
@@ -97,9 +97,9 @@ namespace RandomizerCheckObjects {
     bool AreaIsDungeon(RandomizerCheckArea area);
     bool AreaIsOverworld(RandomizerCheckArea area);
     std::string GetRCAreaName(RandomizerCheckArea area);
-    std::map<RandomizerCheck, RandomizerCheckObject> GetAllRCObjects();
-    std::map<RandomizerCheckArea, std::map<RandomizerCheck, RandomizerCheckObject*>> GetAllRCObjectsByArea();
-    std::map<SceneID, RandomizerCheckArea> GetAllRCAreaBySceneID();
+    std::map<RandomizerCheck, RandomizerCheckObject>& GetAllRCObjects();
+    std::map<RandomizerCheckArea, std::map<RandomizerCheck, RandomizerCheckObject*>>& GetAllRCObjectsByArea();
+    std::map<SceneID, RandomizerCheckArea>& GetAllRCAreaBySceneID();
     RandomizerCheckArea GetRCAreaBySceneID(SceneID sceneId);
     void UpdateImGuiVisibility();
 }
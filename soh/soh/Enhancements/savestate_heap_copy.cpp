@@ -0,0 +1,55 @@
+#include "savestate_heap_copy.h"
+
+#include <cstring>
+
+void SaveStateHeapCopy::Save(const unsigned char* heap, size_t size, const SaveStateHeapCopy* previous) {
+    size_t pageCount = size / SAVE_STATE_PAGE_SIZE;
+    std::vector<std::shared_ptr<SaveStatePage>> oldPages = std::move(this->pages);
+    std::vector<std::shared_ptr<SaveStatePage>> newPages(pageCount);
+    const std::vector<std::shared_ptr<SaveStatePage>>* previousPages = nullptr;
+
+    if (previous == this) {
+        previousPages = &oldPages;
+    } else if (previous != nullptr) {
+        previousPages = &previous->pages;
+    }
+
+    if (previousPages != nullptr) {
+        for (size_t i = 0; i < pageCount && i < previousPages->size(); i++) {
+            if (memcmp((*previousPages)[i]->data(), heap + i * SAVE_STATE_PAGE_SIZE, SAVE_STATE_PAGE_SIZE) == 0) {
+                newPages[i] = (*previousPages)[i];
+            }
+        }
+    }
+
+    // Changed pages are copied into pages of the old contents that nothing else holds any more,
+    // so re-saving a slot or recycling a rewind state doesn't allocate for every changed page
+    size_t nextOldPage = 0;
+    for (size_t i = 0; i < pageCount; i++) {
+        if (newPages[i] != nullptr) {
+            continue;
+        }
+
+        std::shared_ptr<SaveStatePage> page = nullptr;
+        while (page == nullptr && nextOldPage < oldPages.size()) {
+            if (oldPages[nextOldPage].use_count() == 1) {
+                page = std::move(oldPages[nextOldPage]);
+            }
+            nextOldPage++;
+        }
+        if (page == nullptr) {
+            page = std::make_shared<SaveStatePage>();
+        }
+
+        memcpy(page->data(), heap + i * SAVE_STATE_PAGE_SIZE, SAVE_STATE_PAGE_SIZE);
+        newPages[i] = std::move(page);
+    }
+
+    this->pages = std::move(newPages);
+}
+
+void SaveStateHeapCopy::Load(unsigned char* heap) const {
+    for (size_t i = 0; i < this->pages.size(); i++) {
+        memcpy(heap + i * SAVE_STATE_PAGE_SIZE, this->pages[i]->data(), SAVE_STATE_PAGE_SIZE);
+    }
+}
@@ -0,0 +1,26 @@
+#ifndef SAVE_STATE_HEAP_COPY_H
+#define SAVE_STATE_HEAP_COPY_H
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#define SAVE_STATE_PAGE_SIZE 0x1000
+
+typedef std::array<unsigned char, SAVE_STATE_PAGE_SIZE> SaveStatePage;
+
+// Copy of a heap split into pages. Pages that did not change since the previously saved state are
+// shared with it instead of being copied again, so filling every slot in the same area costs little
+// more than a single state.
+class SaveStateHeapCopy {
+  public:
+    // previous may be this copy itself when a state is saved over again
+    void Save(const unsigned char* heap, size_t size, const SaveStateHeapCopy* previous);
+    void Load(unsigned char* heap) const;
+
+  private:
+    std::vector<std::shared_ptr<SaveStatePage>> pages;
+};
+
+#endif
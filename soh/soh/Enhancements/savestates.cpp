@@ -1,8 +1,12 @@
 #include "savestates.h"
+#include "savestate_heap_copy.h"
 
 #include <GameVersions.h>
 
 #include <cstdio> // std::sprintf
+#include <algorithm>
+#include <array>
+#include <vector>
 
 #include <spdlog/spdlog.h>
 #include <spdlog/fmt/fmt.h>
@@ -11,6 +15,7 @@
 #include <soh/OTRAudio.h>
 
 #include <ImGuiImpl.h>
+#include <libultraship/bridge.h>
 
 #include "z64.h"
 #include "z64save.h"
@@ -33,6 +38,7 @@ template <> struct fmt::formatter<RequestType> {
         switch (type) {
             case RequestType::SAVE: return fmt::format_to(ctx.out(), "Save");
             case RequestType::LOAD: return fmt::format_to(ctx.out(), "Load");
+            case RequestType::REWIND: return fmt::format_to(ctx.out(), "Rewind");
             default: return fmt::format_to(ctx.out(), "Unknown");
         }
     }
@@ -50,9 +56,12 @@ typedef struct {
 
 #include "savestates_extern.inc"
 
+static_assert(SYSTEM_HEAP_SIZE % SAVE_STATE_PAGE_SIZE == 0 && AUDIO_HEAP_SIZE % SAVE_STATE_PAGE_SIZE == 0,
+              "Heap sizes must be a multiple of the savestate page size");
+
 typedef struct SaveStateInfo {
-    unsigned char sysHeapCopy[SYSTEM_HEAP_SIZE];
-    unsigned char audioHeapCopy[AUDIO_HEAP_SIZE];
+    SaveStateHeapCopy sysHeapCopy;
+    SaveStateHeapCopy audioHeapCopy;
 
     SaveContext saveContextCopy;
     GameInfo gameInfoCopy;
@@ -76,6 +85,8 @@ typedef struct SaveStateInfo {
     uint8_t gAudioSfxSwapMode_copy[10];
     void (*D_801755D0_copy)(void);
     MapMarkData** sLoadedMarkDataTableCopy;
+    struct ZeldaArenaPool* sZeldaArenaPoolCopy;
+    EffectSsInfo sEffectSsInfoCopy;
 
     //Static Data
 
@@ -372,10 +383,15 @@ class SaveState {
     SaveStateInfo* GetSaveStateInfo(void);
 };
 
-SaveStateMgr::SaveStateMgr() {
+// Rewind states are kept outside of the numbered slots
+#define REWIND_STATE_SLOT 0xFFFFFFFF
+
+SaveStateMgr::SaveStateMgr() : rewindFrameCounter(0) {
     this->SetCurrentSlot(0);
 }
 SaveStateMgr::~SaveStateMgr() { 
+    this->lastSavedState = nullptr;
+    this->rewindStates.clear();
     this->states.clear();
 }
 
@@ -713,6 +729,8 @@ void SaveState::SaveMiscCodeData(void) {
     info->gGameOverTimer_copy = gGameOverTimer;
     info->gTimeIncrement_copy = gTimeIncrement;
     info->sLoadedMarkDataTableCopy = sLoadedMarkDataTable;
+    info->sZeldaArenaPoolCopy = sZeldaArenaPool;
+    info->sEffectSsInfoCopy = sEffectSsInfo;
 
     info->sPlayerInitialPosX_copy = sPlayerInitialPosX;
     info->sPlayerInitialPosZ_copy = sPlayerInitialPosZ;
@@ -774,6 +792,9 @@ void SaveState::LoadMiscCodeData(void) {
     gGameOverTimer = info->gGameOverTimer_copy;
     gTimeIncrement = info->gTimeIncrement_copy;
     sLoadedMarkDataTable = info->sLoadedMarkDataTableCopy;
+    sZeldaArenaPool = info->sZeldaArenaPoolCopy;
+    sEffectSsInfo = info->sEffectSsInfoCopy;
+    EffectSs_ResyncSlots();
 
     sPlayerInitialPosX = info->sPlayerInitialPosX_copy;
     sPlayerInitialPosZ = info->sPlayerInitialPosZ_copy;
@@ -855,6 +876,7 @@ void SaveStateMgr::ProcessSaveStateRequests(void) {
                     this->states[request.slot] = std::make_shared<SaveState>(OTRGlobals::Instance->gSaveStateMgr, request.slot);
                 }
                 this->states[request.slot]->Save();
+                this->lastSavedState = this->states[request.slot];
                 SohImGui::GetGameOverlay()->TextDrawNotification(1.0f, true, "saved state %u", request.slot);
                 break;
             case RequestType::LOAD:
@@ -865,12 +887,54 @@ void SaveStateMgr::ProcessSaveStateRequests(void) {
                     SPDLOG_ERROR("Invalid SaveState slot: {}", request.type);
                 }
                 break;
+            case RequestType::REWIND:
+                if (!this->rewindStates.empty()) {
+                    this->rewindStates.back()->Load();
+                    // Drop the state we just went back to so the next rewind steps further back. The oldest
+                    // state stays, so rewinding again always has somewhere to go.
+                    if (this->rewindStates.size() > 1) {
+                        this->rewindStates.pop_back();
+                    }
+                    this->rewindFrameCounter = 0;
+                    SohImGui::GetGameOverlay()->TextDrawNotification(1.0f, true, "rewound (%u left)",
+                                                                     (unsigned int)this->rewindStates.size());
+                }
+                break;
             [[unlikely]] default: 
                 SPDLOG_ERROR("Invalid SaveState request type: {}", request.type);
                 break;
         }
         this->requests.pop();
     }
+
+    if (CVarGetInteger("gRewindEnabled", 0) && gPlayState != nullptr) {
+        if (++this->rewindFrameCounter >= (unsigned int)CVarGetInteger("gRewindInterval", 20)) {
+            this->rewindFrameCounter = 0;
+            CaptureRewindState();
+        }
+    } else if (!this->rewindStates.empty()) {
+        this->rewindStates.clear();
+        this->rewindFrameCounter = 0;
+    }
+}
+
+void SaveStateMgr::CaptureRewindState(void) {
+    std::shared_ptr<SaveState> state = nullptr;
+    size_t maxStates = std::max(CVarGetInteger("gRewindBufferSize", 10), 1);
+
+    while (this->rewindStates.size() >= maxStates) {
+        // Reuse the oldest state, its pages are released as the new capture replaces them
+        state = this->rewindStates.front();
+        this->rewindStates.pop_front();
+    }
+    if (state == nullptr) {
+        state = std::make_shared<SaveState>(OTRGlobals::Instance->gSaveStateMgr, REWIND_STATE_SLOT);
+    }
+
+    // Consecutive captures share every heap page that did not change in between
+    state->Save();
+    this->lastSavedState = state;
+    this->rewindStates.push_back(state);
 }
 
 SaveStateReturn SaveStateMgr::AddRequest(const SaveStateRequest request) {
@@ -893,6 +957,14 @@ SaveStateReturn SaveStateMgr::AddRequest(const SaveStateRequest request) {
                 SohImGui::GetGameOverlay()->TextDrawNotification(1.0f, true, "state slot %u empty", request.slot);
                 return SaveStateReturn::FAIL_INVALID_SLOT;
             }
+        case RequestType::REWIND:
+            if (!rewindStates.empty()) {
+                requests.push(request);
+                return SaveStateReturn::SUCCESS;
+            } else {
+                SohImGui::GetGameOverlay()->TextDrawNotification(1.0f, true, "nothing to rewind");
+                return SaveStateReturn::FAIL_STATE_EMPTY;
+            }
         [[unlikely]] default: 
             SPDLOG_ERROR("Invalid SaveState request type: {}", request.type);
             return SaveStateReturn::FAIL_BAD_REQUEST;
@@ -900,9 +972,17 @@ SaveStateReturn SaveStateMgr::AddRequest(const SaveStateRequest request) {
 }
 
 void SaveState::Save(void) {
+    std::shared_ptr<SaveStateInfo> previous = nullptr;
+    if (saveStateMgr->lastSavedState != nullptr) {
+        previous = saveStateMgr->lastSavedState->info;
+    }
+
+    // The audio thread only has to wait for a plain copy of its heap. Comparing pages against the previous
+    // state happens after the lock is released, on the snapshot
+    static std::vector<unsigned char> audioHeapSnapshot(AUDIO_HEAP_SIZE);
+
     std::unique_lock<std::mutex> Lock(audio.mutex);
-    memcpy(&info->sysHeapCopy, gSystemHeap, SYSTEM_HEAP_SIZE /* sizeof(gSystemHeap) */);
-    memcpy(&info->audioHeapCopy, gAudioHeap, AUDIO_HEAP_SIZE /* sizeof(gAudioContext) */);
+    memcpy(audioHeapSnapshot.data(), gAudioHeap, AUDIO_HEAP_SIZE);
 
     memcpy(&info->audioContextCopy, &gAudioContext, sizeof(AudioContext));
     memcpy(&info->unk_D_8016E750Copy, D_8016E750, sizeof(info->unk_D_8016E750Copy));
@@ -935,13 +1015,18 @@ void SaveState::Save(void) {
     SaveOnePointDemoData();
     SaveOverlayStaticData();
     SaveMiscCodeData();
+    Lock.unlock();
 
+    // The system heap is only written by the game thread, which is the one saving
+    info->sysHeapCopy.Save(gSystemHeap, SYSTEM_HEAP_SIZE, previous != nullptr ? &previous->sysHeapCopy : nullptr);
+    info->audioHeapCopy.Save(audioHeapSnapshot.data(), AUDIO_HEAP_SIZE,
+                             previous != nullptr ? &previous->audioHeapCopy : nullptr);
 }
 
 void SaveState::Load(void) {
     std::unique_lock<std::mutex> Lock(audio.mutex);
-    memcpy(gSystemHeap, &info->sysHeapCopy, SYSTEM_HEAP_SIZE);
-    memcpy(gAudioHeap, &info->audioHeapCopy, AUDIO_HEAP_SIZE);
+    info->sysHeapCopy.Load(gSystemHeap);
+    info->audioHeapCopy.Load(gAudioHeap);
 
     memcpy(&gAudioContext, &info->audioContextCopy, sizeof(AudioContext));
     memcpy(D_8016E750, &info->unk_D_8016E750Copy, sizeof(info->unk_D_8016E750Copy));
@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <queue>
+#include <deque>
 #include <unordered_map>
 #include <memory>
 #include <mutex>
@@ -25,6 +26,7 @@ typedef struct SaveStateHeader {
 enum class RequestType {
     SAVE,
     LOAD,
+    REWIND,
 };
 
 typedef struct SaveStateRequest {
@@ -39,8 +41,13 @@ class SaveStateMgr {
   private:
     unsigned int currentSlot;
     std::unordered_map<unsigned int, std::shared_ptr<SaveState>> states;
+    std::shared_ptr<SaveState> lastSavedState;
+    std::deque<std::shared_ptr<SaveState>> rewindStates;
+    unsigned int rewindFrameCounter;
     std::queue <SaveStateRequest> requests;
     std::mutex mutex;
+
+    void CaptureRewindState(void);
     
   public:
 
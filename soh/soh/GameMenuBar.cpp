@@ -145,6 +145,12 @@ namespace GameMenuBar {
                     ImGui::PopStyleVar(1);
                 }
 
+                UIWidgets::Spacer(0);
+                ImGui::Text("Underruns: %u  Overruns: %u", OTRAudio_GetUnderrunCount(), OTRAudio_GetOverrunCount());
+                if (ImGui::Button("Reset Audio Stats")) {
+                    OTRAudio_ResetStats();
+                }
+
                 ImGui::EndMenu();
             }
 
@@ -1003,6 +1009,14 @@ namespace GameMenuBar {
                 UIWidgets::PaddedEnhancementCheckbox("Kokiri Draw Distance", "gDisableKokiriDrawDistance", true, false);
                 UIWidgets::Tooltip("The Kokiri are mystical beings that fade into view when approached\nEnabling this will remove their draw distance");
             }
+            UIWidgets::PaddedEnhancementCheckbox("Raise Collider Limits", "gRaiseColliderLimits", true, false);
+            UIWidgets::Tooltip("Raises the number of attack, hurtbox and push colliders that can be active at once\nWithout this, colliders past the original limits are ignored, which can leave enemies in crowded scenes unhittable");
+            UIWidgets::PaddedEnhancementCheckbox("Compact Static Collision", "gCompactStaticCollision", true, false);
+            UIWidgets::Tooltip("Lays out the scene collision lookup so that floor, wall and line checks read it sequentially\nCollision results are unchanged. Applies to every scene from the next scene load on");
+            UIWidgets::PaddedEnhancementCheckbox("Size-Class Actor Heap", "gZeldaArenaSizeClasses", true, false);
+            UIWidgets::Tooltip("Serves small allocations such as actors from pools of fixed-size blocks instead of searching the whole heap\nReduces heap fragmentation when many actors are spawned. Takes effect on the next scene load\nUse the \"arena_stats\" console command to see heap usage");
+            UIWidgets::PaddedEnhancementSliderInt("Effect Limit: %d", "##EffectSsTableSize", "gEffectSsTableSize", EFFECT_SS_TABLE_SIZE, EFFECT_SS_TABLE_SIZE_MAX, "", EFFECT_SS_TABLE_SIZE, true);
+            UIWidgets::Tooltip("Number of particle effects such as dust, sparks and fire that can exist at once\nWhen the limit is reached, new effects replace lower priority ones or are not spawned. Takes effect on the next scene load");
             UIWidgets::PaddedEnhancementCheckbox("Skip Text", "gSkipText", true, false);
             UIWidgets::Tooltip("Holding down B skips text");
 
@@ -1176,6 +1190,12 @@ namespace GameMenuBar {
             UIWidgets::Tooltip("Optimized debug warp screen, with the added ability to chose entrances and time of day");
             UIWidgets::PaddedEnhancementCheckbox("Debug Warp Screen Translation", "gDebugWarpScreenTranslation", true, false);
             UIWidgets::Tooltip("Translate the Debug Warp Screen based on the game language");
+            UIWidgets::PaddedEnhancementCheckbox("Rewind", "gRewindEnabled", true, false);
+            UIWidgets::Tooltip("Periodically captures a state while playing, press F8 (or use the \"rewind\" console command) to step back through them");
+            if (CVarGetInteger("gRewindEnabled", 0)) {
+                UIWidgets::PaddedEnhancementSliderInt("Rewind interval: %d frames", "##REWINDINTERVAL", "gRewindInterval", 1, 60, "", 20, false, false, true);
+                UIWidgets::PaddedEnhancementSliderInt("Rewind states: %d", "##REWINDSTATES", "gRewindBufferSize", 1, 60, "", 10, false, false, true);
+            }
             UIWidgets::PaddedSeparator();
             ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(12.0f, 6.0f));
             ImGui::PushStyleVar(ImGuiStyleVar_ButtonTextAlign, ImVec2(0,0));
@@ -2,6 +2,8 @@
 #include "OTRAudio.h"
 #include <iostream>
 #include <algorithm>
+#include <atomic>
+#include <unordered_map>
 #include <filesystem>
 #include <fstream>
 #include <helix/helix.h>
@@ -34,6 +36,7 @@
 #include "Enhancements/audio/AudioEditor.h"
 #include "Enhancements/debugconsole.h"
 #include "Enhancements/debugger/debugger.h"
+#include "Enhancements/cvar_cache.h"
 #include "Enhancements/randomizer/randomizer.h"
 #include "Enhancements/randomizer/randomizer_entrance_tracker.h"
 #include "Enhancements/randomizer/randomizer_item_tracker.h"
@@ -343,9 +346,16 @@ extern "C" void AudioPlayer_Play(const uint8_t* buf, uint32_t len);
 extern "C" int AudioPlayer_Buffered(void);
 extern "C" int AudioPlayer_GetDesiredBuffered(void);
 extern "C" void ResourceMgr_CacheDirectory(const char* resName);
+extern "C" void ResourceMgr_ClearResolvedResourceCache();
 extern "C" SequenceData ResourceMgr_LoadSeqByName(const char* path);
 std::unordered_map<std::string, ExtensionEntry> ExtensionCache;
 
+// Audio backend statistics, readable from the menu bar.
+// Underrun: the backend had nothing queued when we started synthesizing a frame.
+// Overrun: the backend had more than twice its desired level queued.
+static std::atomic<uint32_t> sAudioUnderruns(0);
+static std::atomic<uint32_t> sAudioOverruns(0);
+
 void OTRAudio_Thread() {
     while (audio.running) {
         {
@@ -376,7 +386,14 @@ void OTRAudio_Thread() {
         #define NUM_AUDIO_CHANNELS 2
 
         int samples_left = AudioPlayer_Buffered();
-        u32 num_audio_samples = samples_left < AudioPlayer_GetDesiredBuffered() ? SAMPLES_HIGH : SAMPLES_LOW;
+        int desired_buffered = AudioPlayer_GetDesiredBuffered();
+        u32 num_audio_samples = samples_left < desired_buffered ? SAMPLES_HIGH : SAMPLES_LOW;
+
+        if (samples_left == 0) {
+            sAudioUnderruns++;
+        } else if (samples_left > desired_buffered * 2) {
+            sAudioOverruns++;
+        }
 
         // 3 is the maximum authentic frame divisor.
         s16 audio_buffer[SAMPLES_HIGH * NUM_AUDIO_CHANNELS * 3];
@@ -416,6 +433,19 @@ extern "C" void OTRAudio_Exit() {
     HLXAudioPlayerDeinit(OTRGlobals::AudioPlayer);
 }
 
+uint32_t OTRAudio_GetUnderrunCount() {
+    return sAudioUnderruns;
+}
+
+uint32_t OTRAudio_GetOverrunCount() {
+    return sAudioOverruns;
+}
+
+void OTRAudio_ResetStats() {
+    sAudioUnderruns = 0;
+    sAudioOverruns = 0;
+}
+
 extern "C" void VanillaItemTable_Init() {
     static GetItemEntry getItemTable[] = {
         GET_ITEM(ITEM_BOMBS_5,          OBJECT_GI_BOMB_1,        GID_BOMB,             0x32, 0x59, CHEST_ANIM_SHORT, ITEM_CATEGORY_JUNK,            MOD_NONE, GI_BOMBS_5),
@@ -626,6 +656,7 @@ extern "C" void InitOTR() {
 }
 
 extern "C" void DeinitOTR() {
+    SaveManager::Instance->Shutdown();
     OTRAudio_Exit();
     HLXSpeechSynthesizerDeinit(OTRGlobals::SpeechSynthesizer);
 #ifdef ENABLE_CROWD_CONTROL
@@ -727,18 +758,29 @@ extern "C" void Graph_StartFrame() {
 
             break;
         }
+        case SDL_SCANCODE_F8: {
+            const SaveStateReturn stateReturn =
+                OTRGlobals::Instance->gSaveStateMgr->AddRequest({ 0, RequestType::REWIND });
+
+            if (stateReturn == SaveStateReturn::SUCCESS) {
+                SPDLOG_INFO("[SOH] Rewinding");
+            }
+            break;
+        }
         case SDL_SCANCODE_F9: {
             // Toggle TTS
             CVarSetInteger("gA11yTTS", !CVarGetInteger("gA11yTTS", 0));
         }
     }
 #endif
+    CVarCache_Invalidate();
     OTRGlobals::Instance->context->StartFrame();
 }
 
-void RunCommands(Gfx* Commands, const std::vector<std::unordered_map<Mtx*, MtxF>>& mtx_replacements) {
-    for (const auto& m : mtx_replacements) {
-        gfx_run(Commands, m);
+void RunCommands(Gfx* Commands, const std::vector<std::unordered_map<Mtx*, MtxF>>& mtx_replacements,
+                 size_t frame_count) {
+    for (size_t i = 0; i < frame_count; i++) {
+        gfx_run(Commands, mtx_replacements[i]);
         gfx_end_frame();
     }
 }
@@ -751,7 +793,11 @@ extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
     }
 
     audio.cv_to_thread.notify_one();
-    std::vector<std::unordered_map<Mtx*, MtxF>> mtx_replacements;
+    // Kept between frames: the interpolated matrices are written into a reused dense array, and gfx_run's maps keep
+    // their buckets when cleared
+    static std::vector<FrameInterpolationMtx> interpolated_mtxs;
+    static std::vector<std::unordered_map<Mtx*, MtxF>> mtx_replacements;
+    size_t frame_count = 0;
     int target_fps = OTRGlobals::Instance->GetInterpolationFPS();
     static int last_fps;
     static int last_update_rate;
@@ -772,11 +818,21 @@ extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
 
     while (time + original_fps <= next_original_frame) {
         time += original_fps;
-        if (time != next_original_frame) {
-            mtx_replacements.push_back(FrameInterpolation_Interpolate((float)time / next_original_frame));
-        } else {
+        if (frame_count == mtx_replacements.size()) {
             mtx_replacements.emplace_back();
         }
+        auto& replacements = mtx_replacements[frame_count];
+        replacements.clear();
+        if (time != next_original_frame) {
+            FrameInterpolation_Interpolate((float)time / next_original_frame, interpolated_mtxs);
+            // gfx_run looks the matrices up by address
+            for (const auto& mtx : interpolated_mtxs) {
+                if (mtx.dest != nullptr) {
+                    replacements[mtx.dest] = mtx.mtx;
+                }
+            }
+        }
+        frame_count++;
     }
 
     time -= fps;
@@ -786,11 +842,13 @@ extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
     int threshold = CVarGetInteger("gExtraLatencyThreshold", 80);
     OTRGlobals::Instance->context->SetMaximumFrameLatency(threshold > 0 && target_fps >= threshold ? 2 : 1);
 
-    RunCommands(commands, mtx_replacements);
+    RunCommands(commands, mtx_replacements, frame_count);
 
     last_fps = fps;
     last_update_rate = R_UPDATE_RATE;
 
+    // The audio thread reads gAudioContext and the audio command queues that the next game update writes, so it has
+    // to finish its frame before the game goes on
     {
         std::unique_lock<std::mutex> Lock(audio.mutex);
         while (audio.processing) {
@@ -868,6 +926,7 @@ extern "C" void ResourceMgr_CacheDirectory(const char* resName) {
 }
 extern "C" void ResourceMgr_DirtyDirectory(const char* resName) {
     OTRGlobals::Instance->context->GetResourceManager()->DirtyDirectory(resName);
+    ResourceMgr_ClearResolvedResourceCache();
 }
 
 // OTRTODO: There is probably a more elegant way to go about this...
@@ -901,6 +960,30 @@ std::shared_ptr<Ship::Resource> GetResourceByNameHandlingMQ(const char* path) {
     return OTRGlobals::Instance->context->GetResourceManager()->LoadResource(Path.c_str());
 }
 
+// Resolved by-name lookups for the per-frame loaders (animations, skeletons, vertices). Keyed by the address of the
+// "__OTR__" path string, which is static asset data, so a hit never needs to rebuild or rehash the path. Cleared on
+// scene change and whenever a directory is dirtied.
+static std::unordered_map<const char*, std::shared_ptr<Ship::Resource>> sResolvedResources;
+
+extern "C" void ResourceMgr_ClearResolvedResourceCache() {
+    sResolvedResources.clear();
+}
+
+static void* GetCachedResourceDataByName(const char* path) {
+    auto it = sResolvedResources.find(path);
+    if (it != sResolvedResources.end() && !it->second->IsDirty) {
+        return it->second->GetPointer();
+    }
+
+    auto res = OTRGlobals::Instance->context->GetResourceManager()->LoadResource(path);
+    if (res == nullptr) {
+        return nullptr;
+    }
+
+    sResolvedResources[path] = res;
+    return res->GetPointer();
+}
+
 extern "C" char* GetResourceDataByNameHandlingMQ(const char* path) {
     auto res = GetResourceByNameHandlingMQ(path);
     
@@ -1083,7 +1166,7 @@ extern "C" CollisionHeader* ResourceMgr_LoadColByName(const char* path) {
 }
 
 extern "C" Vtx* ResourceMgr_LoadVtxByName(char* path) {
-    return (Vtx*)GetResourceDataByName(path, false);
+    return (Vtx*)GetCachedResourceDataByName(path);
 }
 
 extern "C" SequenceData ResourceMgr_LoadSeqByName(const char* path) {
@@ -1178,11 +1261,11 @@ extern "C" int ResourceMgr_OTRSigCheck(char* imgData)
 }
 
 extern "C" AnimationHeaderCommon* ResourceMgr_LoadAnimByName(const char* path) {
-    return (AnimationHeaderCommon*)GetResourceDataByName(path, false);
+    return (AnimationHeaderCommon*)GetCachedResourceDataByName(path);
 }
 
 extern "C" SkeletonHeader* ResourceMgr_LoadSkeletonByName(const char* path) {
-    return (SkeletonHeader*)GetResourceDataByName(path, false);
+    return (SkeletonHeader*)GetCachedResourceDataByName(path);
 }
 
 extern "C" s32* ResourceMgr_LoadCSByName(const char* path) {
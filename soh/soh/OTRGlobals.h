@@ -41,6 +41,9 @@ private:
 };
 
 uint32_t IsGameMasterQuest();
+uint32_t OTRAudio_GetUnderrunCount();
+uint32_t OTRAudio_GetOverrunCount();
+void OTRAudio_ResetStats();
 #endif
 
 #ifndef __cplusplus
@@ -62,6 +65,7 @@ uint32_t ResourceMgr_GameHasOriginal();
 uint32_t ResourceMgr_GetNumGameVersions();
 uint32_t ResourceMgr_GetGameVersion(int index);
 void ResourceMgr_CacheDirectory(const char* resName);
+void ResourceMgr_ClearResolvedResourceCache();
 char** ResourceMgr_ListFiles(const char* searchMask, int* resultSize);
 char* GetResourceDataByNameHandlingMQ(const char* path);
 void ResourceMgr_LoadFile(const char* resName);
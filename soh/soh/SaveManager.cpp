@@ -15,6 +15,7 @@
 #include <fstream>
 #include <filesystem>
 #include <array>
+#include <algorithm>
 
 extern "C" SaveContext gSaveContext;
 
@@ -709,19 +710,95 @@ void SaveManager::SaveFile(int fileNum) {
     }
 
 #if defined(__SWITCH__) || defined(__WIIU__)
-    FILE* w = fopen(GetFileName(fileNum).c_str(), "w");
-    std::string json_string = baseBlock.dump(4);
-    fwrite(json_string.c_str(), sizeof(char), json_string.length(), w);
-    fclose(w);
+    WriteSaveFile(GetFileName(fileNum), baseBlock);
 #else
-    std::ofstream output(GetFileName(fileNum));
-    output << std::setw(4) << baseBlock << std::endl;
+    {
+        std::unique_lock<std::mutex> lock(saveMutex);
+        if (!saveThread.joinable()) {
+            saveThreadExit = false;
+            saveThread = std::thread(&SaveManager::ProcessSaveQueue, this);
+        }
+
+        // A write that has not started yet is superseded by the newer snapshot of the same file
+        auto queued = std::find_if(saveQueue.begin(), saveQueue.end(),
+                                   [&](const auto& entry) { return entry.first == GetFileName(fileNum); });
+        if (queued != saveQueue.end()) {
+            queued->second = std::move(baseBlock);
+        } else {
+            saveQueue.emplace_back(GetFileName(fileNum), std::move(baseBlock));
+        }
+    }
+    saveCondition.notify_all();
 #endif
 
     InitMeta(fileNum);
     GameInteractor::Instance->ExecuteHooks<GameInteractor::OnSaveFile>(fileNum);
 }
 
+void SaveManager::WriteSaveFile(const std::filesystem::path& fileName, const nlohmann::json& saveBlock) {
+#if defined(__SWITCH__) || defined(__WIIU__)
+    FILE* w = fopen(fileName.c_str(), "w");
+    std::string json_string = saveBlock.dump(4);
+    fwrite(json_string.c_str(), sizeof(char), json_string.length(), w);
+    fclose(w);
+#else
+    // Write next to the save and swap it in so an interrupted write never leaves a truncated file behind
+    std::filesystem::path tempFileName = fileName;
+    tempFileName += ".tmp";
+    {
+        std::ofstream output(tempFileName);
+        output << std::setw(4) << saveBlock << std::endl;
+        if (!output) {
+            SPDLOG_ERROR("Failed to write save " + fileName.string());
+            return;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempFileName, fileName, ec);
+    if (ec) {
+        SPDLOG_ERROR("Failed to replace save " + fileName.string() + ": " + ec.message());
+    }
+#endif
+}
+
+void SaveManager::ProcessSaveQueue() {
+    std::unique_lock<std::mutex> lock(saveMutex);
+    while (true) {
+        saveCondition.wait(lock, [this] { return saveThreadExit || !saveQueue.empty(); });
+        if (saveQueue.empty()) {
+            return;
+        }
+
+        auto [fileName, saveBlock] = std::move(saveQueue.front());
+        saveQueue.pop_front();
+        saveInProgress = true;
+
+        lock.unlock();
+        WriteSaveFile(fileName, saveBlock);
+        lock.lock();
+
+        saveInProgress = false;
+        saveCondition.notify_all();
+    }
+}
+
+void SaveManager::WaitForPendingSaves() {
+    std::unique_lock<std::mutex> lock(saveMutex);
+    saveCondition.wait(lock, [this] { return saveQueue.empty() && !saveInProgress; });
+}
+
+void SaveManager::Shutdown() {
+    {
+        std::unique_lock<std::mutex> lock(saveMutex);
+        saveThreadExit = true;
+    }
+    saveCondition.notify_all();
+    if (saveThread.joinable()) {
+        saveThread.join();
+    }
+}
+
 void SaveManager::SaveGlobal() {
     nlohmann::json globalBlock;
     globalBlock["version"] = 1;
@@ -737,6 +814,7 @@ void SaveManager::SaveGlobal() {
 }
 
 void SaveManager::LoadFile(int fileNum) {
+    WaitForPendingSaves();
     assert(std::filesystem::exists(GetFileName(fileNum)));
     InitFile(false);
 
@@ -785,6 +863,7 @@ void SaveManager::LoadFile(int fileNum) {
 }
 
 bool SaveManager::SaveFile_Exist(int fileNum) {
+    WaitForPendingSaves();
     try {
         bool exists = std::filesystem::exists(GetFileName(fileNum));
         SPDLOG_INFO("File[{}] - {}", fileNum, exists ? "exists" : "does not exist" );
@@ -1691,6 +1770,7 @@ int copy_file(const char* src, const char* dst)
 #endif
 
 void SaveManager::CopyZeldaFile(int from, int to) {
+    WaitForPendingSaves();
     assert(std::filesystem::exists(GetFileName(from)));
     DeleteZeldaFile(to);
 #if defined(__WIIU__) || defined(__SWITCH__)
@@ -1721,6 +1801,7 @@ void SaveManager::CopyZeldaFile(int from, int to) {
 }
 
 void SaveManager::DeleteZeldaFile(int fileNum) {
+    WaitForPendingSaves();
     if (std::filesystem::exists(GetFileName(fileNum))) {
         std::filesystem::remove(GetFileName(fileNum));
     }
@@ -28,6 +28,10 @@ typedef struct {
 #include <functional>
 #include <vector>
 #include <filesystem>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include <nlohmann/json.hpp>
 
@@ -49,6 +53,11 @@ public:
     void LoadFile(int fileNum);
     bool SaveFile_Exist(int fileNum);
 
+    // Blocks until every save queued by SaveFile has been written to disk.
+    void WaitForPendingSaves();
+    // Flushes pending saves and stops the save thread.
+    void Shutdown();
+
     // Adds a function that is called when we are intializing a save, including when we are loading a save.
     void AddInitFunction(InitFunc func);
 
@@ -116,6 +125,8 @@ public:
     void CreateDefaultGlobal();
 
     void InitMeta(int slotNum);
+    void ProcessSaveQueue();
+    static void WriteSaveFile(const std::filesystem::path& fileName, const nlohmann::json& saveBlock);
     static void InitFileImpl(bool isDebug);
     static void InitFileNormal();
     static void InitFileDebug();
@@ -141,6 +152,14 @@ public:
 
     nlohmann::json* currentJsonContext = nullptr;
     nlohmann::json::iterator currentJsonArrayContext;
+
+    // Save files are snapshotted on the game thread and written out on saveThread
+    std::thread saveThread;
+    std::mutex saveMutex;
+    std::condition_variable saveCondition;
+    std::deque<std::pair<std::filesystem::path, nlohmann::json>> saveQueue;
+    bool saveInProgress = false;
+    bool saveThreadExit = false;
 };
 
 #else
@@ -1,8 +1,7 @@
 #include <libultraship/bridge.h>
 
 #include <vector>
-#include <map>
-#include <unordered_map>
+#include <algorithm>
 #include <math.h>
 
 #include "frame_interpolation.h"
@@ -105,6 +104,8 @@ namespace {
         SkinMatrixMtxFToMtx
     };
 
+    constexpr size_t kOpCount = (size_t)Op::SkinMatrixMtxFToMtx + 1;
+
     typedef pair<const void*, int> label;
 
     union Data {
@@ -151,10 +152,12 @@ namespace {
         struct {
             MtxF src;
             Mtx* dest;
+            uint32_t slot;
         } matrix_mtxf_to_mtx;
 
         struct {
             Mtx* dest;
+            uint32_t slot;
             MtxF src;
             bool has_adjusted;
         } matrix_to_mtx;
@@ -170,23 +173,132 @@ namespace {
         } matrix_rotate_axis;
 
         struct {
-            label key;
-            size_t idx;
+            uint32_t node;
         } open_child;
     };
 
-    struct Path {
-        map<label, vector<Path>> children;
-        map<Op, vector<Data>> ops;
-        vector<pair<Op, size_t>> items;
+    // One recorded op. The ops of a whole frame form a single linear stream in recording order, where a child is
+    // delimited by its OpenChild and CloseChild entries.
+    struct Item {
+        Op op;
+        uint32_t node;    // Node the op was recorded in
+        uint32_t ordinal; // Index among the ops of the same type within that node
+        Data data;
+    };
+
+    struct Node {
+        label key;
+        uint32_t parent;
+        uint32_t occurrence; // Index among the siblings sharing the same label
+        uint32_t stream_begin;
+        uint32_t children_begin, children_end;
+        uint32_t op_count[kOpCount];
+        uint32_t op_start[kOpCount];
+    };
+
+    struct ChildEntry {
+        label key;
+        uint32_t node;
     };
 
+    // A frame recording. All storage is kept between frames and only cleared, so once the vectors have grown to the
+    // size of a typical frame recording no longer allocates.
     struct Recording {
-        Path root_path;
+        vector<Item> stream;
+        vector<Node> nodes;
+        vector<ChildEntry> children; // Grouped by parent, sorted by label and recording order
+        vector<uint32_t> op_index;   // Stream index of each op, grouped by node then by op type
+        uint32_t mtx_slots = 0;
+        bool indexed = false;
+
+        Recording() {
+            clear();
+        }
+
+        void clear() {
+            stream.clear();
+            nodes.clear();
+            children.clear();
+            op_index.clear();
+            mtx_slots = 0;
+            indexed = false;
+            nodes.push_back({});
+            nodes.back().parent = UINT32_MAX;
+        }
+
+        // Builds the lookup tables used to match this recording against an adjacent one. Runs once per original
+        // frame rather than once per interpolated frame.
+        void build_index() {
+            if (indexed) {
+                return;
+            }
+            indexed = true;
+
+            // Children grouped by parent; node ids increase in recording order so sorting by (label, id) gives the
+            // occurrence of each sibling within its label.
+            for (auto& node : nodes) {
+                node.children_begin = node.children_end = 0;
+            }
+            for (uint32_t i = 1; i < nodes.size(); i++) {
+                nodes[nodes[i].parent].children_end++;
+            }
+            uint32_t offset = 0;
+            for (auto& node : nodes) {
+                node.children_begin = offset;
+                offset += node.children_end;
+                node.children_end = node.children_begin;
+            }
+            children.resize(offset);
+            for (uint32_t i = 1; i < nodes.size(); i++) {
+                Node& parent = nodes[nodes[i].parent];
+                children[parent.children_end++] = { nodes[i].key, i };
+            }
+            for (auto& node : nodes) {
+                auto first = children.begin() + node.children_begin;
+                auto last = children.begin() + node.children_end;
+                sort(first, last, [](const ChildEntry& a, const ChildEntry& b) {
+                    return a.key != b.key ? a.key < b.key : a.node < b.node;
+                });
+                for (auto it = first; it != last; ++it) {
+                    nodes[it->node].occurrence = (it != first && (it - 1)->key == it->key) ? nodes[(it - 1)->node].occurrence + 1 : 0;
+                }
+            }
+
+            offset = 0;
+            for (auto& node : nodes) {
+                for (size_t op = 0; op < kOpCount; op++) {
+                    node.op_start[op] = offset;
+                    offset += node.op_count[op];
+                }
+            }
+            op_index.resize(offset);
+            for (uint32_t i = 0; i < stream.size(); i++) {
+                const Item& item = stream[i];
+                op_index[nodes[item.node].op_start[(size_t)item.op] + item.ordinal] = i;
+            }
+        }
+
+        Node* find_child(const Node& parent, const Node& like) {
+            auto first = children.begin() + parent.children_begin;
+            auto last = children.begin() + parent.children_end;
+            auto it = lower_bound(first, last, like.key,
+                                  [](const ChildEntry& e, const label& key) { return e.key < key; });
+            if (last - it <= like.occurrence || (it + like.occurrence)->key != like.key) {
+                return nullptr;
+            }
+            return &nodes[(it + like.occurrence)->node];
+        }
+
+        Item* find_op(const Node& node, Op op, uint32_t ordinal) {
+            if (ordinal >= node.op_count[(size_t)op]) {
+                return nullptr;
+            }
+            return &stream[op_index[node.op_start[(size_t)op] + ordinal]];
+        }
     };
 
     bool is_recording;
-    vector<Path*> current_path;
+    vector<uint32_t> current_path;
     uint32_t camera_epoch;
     uint32_t previous_camera_epoch;
     Recording current_recording;
@@ -198,22 +310,28 @@ namespace {
     size_t inv_actor_mtx_path_index;
 
     Data& append(Op op) {
-        auto& m = current_path.back()->ops[op];
-        current_path.back()->items.emplace_back(op, m.size());
-        return m.emplace_back();
+        uint32_t node = current_path.back();
+        uint32_t ordinal = current_recording.nodes[node].op_count[(size_t)op]++;
+        Item& item = current_recording.stream.emplace_back();
+        item.op = op;
+        item.node = node;
+        item.ordinal = ordinal;
+        return item.data;
     }
 
     struct InterpolateCtx {
+        Recording* new_recording;
+        vector<FrameInterpolationMtx>* replacements;
         float step;
         float w;
-        unordered_map<Mtx*, MtxF> mtx_replacements;
         MtxF tmp_mtxf, tmp_mtxf2;
         Vec3f tmp_vec3f;
         Vec3s tmp_vec3s;
         MtxF actor_mtx;
 
-        MtxF* new_replacement(Mtx* addr) {
-            return &mtx_replacements[addr];
+        MtxF* new_replacement(uint32_t slot, Mtx* addr) {
+            (*replacements)[slot].dest = addr;
+            return &(*replacements)[slot].mtx;
         }
 
         void interpolate_mtxf(MtxF* res, MtxF* o, MtxF* n) {
@@ -294,27 +412,34 @@ namespace {
             res->z = interpolate_angle(o->z, n->z);
         }
 
-        void interpolate_branch(Path* old_path, Path *new_path) {
-            for (auto& item : new_path->items) {
-                Data& new_op = new_path->ops[item.first][item.second];
+        // Walks the ops of new_node in recording order and returns the stream index just past its CloseChild.
+        // Nodes are matched against the old recording by label and sibling index, ops by type and per-type index.
+        uint32_t interpolate_branch(Recording* old_rec, const Node* old_node, const Node* new_node) {
+            auto& stream = new_recording->stream;
+            uint32_t i = new_node->stream_begin;
+            while (i < stream.size()) {
+                Item& item = stream[i++];
+                Data& new_op = item.data;
+
+                if (item.op == Op::CloseChild) {
+                    break;
+                }
 
-                if (item.first == Op::OpenChild) {
-                    if (auto it = old_path->children.find(new_op.open_child.key);
-                        it != old_path->children.end() && new_op.open_child.idx < it->second.size()) {
-                        interpolate_branch(&it->second[new_op.open_child.idx],
-                                            &new_path->children.find(new_op.open_child.key)->second[new_op.open_child.idx]);
+                if (item.op == Op::OpenChild) {
+                    const Node* new_child = &new_recording->nodes[new_op.open_child.node];
+                    Node* old_child = old_rec->find_child(*old_node, *new_child);
+                    if (old_child != nullptr) {
+                        i = interpolate_branch(old_rec, old_child, new_child);
                     } else {
-                        interpolate_branch(
-                            &new_path->children.find(new_op.open_child.key)->second[new_op.open_child.idx],
-                            &new_path->children.find(new_op.open_child.key)->second[new_op.open_child.idx]);
+                        i = interpolate_branch(new_recording, new_child, new_child);
                     }
                     continue;
                 }
 
-                if (auto it = old_path->ops.find(item.first); it != old_path->ops.end()) {
-                    if (item.second < it->second.size()) {
-                        Data& old_op = it->second[item.second];
-                        switch (item.first) {
+                {
+                    if (Item* old_item = old_rec->find_op(*old_node, item.op, item.ordinal)) {
+                        Data& old_op = old_item->data;
+                        switch (item.op) {
                             case Op::OpenChild:
                                 break;
                             case Op::CloseChild:
@@ -400,7 +525,7 @@ namespace {
                                 break;
 
                             case Op::MatrixMtxFToMtx:
-                                interpolate_mtxf(new_replacement(new_op.matrix_mtxf_to_mtx.dest),
+                                interpolate_mtxf(new_replacement(new_op.matrix_mtxf_to_mtx.slot, new_op.matrix_mtxf_to_mtx.dest),
                                                  &old_op.matrix_mtxf_to_mtx.src, &new_op.matrix_mtxf_to_mtx.src);
                                 break;
 
@@ -408,9 +533,10 @@ namespace {
                                 //*new_replacement(new_op.matrix_to_mtx.dest) = *Matrix_GetCurrent();
                                 if (old_op.matrix_to_mtx.has_adjusted && new_op.matrix_to_mtx.has_adjusted) {
                                     interpolate_mtxf(&tmp_mtxf, &old_op.matrix_to_mtx.src, &new_op.matrix_to_mtx.src);
-                                    SkinMatrix_MtxFMtxFMult(&actor_mtx, &tmp_mtxf, new_replacement(new_op.matrix_to_mtx.dest));
+                                    SkinMatrix_MtxFMtxFMult(&actor_mtx, &tmp_mtxf,
+                                                            new_replacement(new_op.matrix_to_mtx.slot, new_op.matrix_to_mtx.dest));
                                 } else {
-                                    interpolate_mtxf(new_replacement(new_op.matrix_to_mtx.dest),
+                                    interpolate_mtxf(new_replacement(new_op.matrix_to_mtx.slot, new_op.matrix_to_mtx.dest),
                                                      &old_op.matrix_to_mtx.src, &new_op.matrix_to_mtx.src);
                                 }
                                 break;
@@ -433,24 +559,34 @@ namespace {
                     }
                 }
             }
+            return i;
         }
     };
 
 } // anonymous namespace
 
-unordered_map<Mtx*, MtxF> FrameInterpolation_Interpolate(float step) {
+void FrameInterpolation_Interpolate(float step, vector<FrameInterpolationMtx>& replacements) {
+    previous_recording.build_index();
+    current_recording.build_index();
+
+    replacements.resize(current_recording.mtx_slots);
+    for (auto& replacement : replacements) {
+        replacement.dest = nullptr;
+    }
+
     InterpolateCtx ctx;
+    ctx.new_recording = &current_recording;
+    ctx.replacements = &replacements;
     ctx.step = step;
     ctx.w = 1.0f - step;
-    ctx.interpolate_branch(&previous_recording.root_path, &current_recording.root_path);
-    return ctx.mtx_replacements;
+    ctx.interpolate_branch(&previous_recording, &previous_recording.nodes[0], &current_recording.nodes[0]);
 }
 
 void FrameInterpolation_StartRecord(void) {
-    previous_recording = move(current_recording);
-    current_recording = {};
+    swap(previous_recording, current_recording);
+    current_recording.clear();
     current_path.clear();
-    current_path.push_back(&current_recording.root_path);
+    current_path.push_back(0);
     if (CVarGetInteger("gInterpolationFPS", 20) != 20) {
         is_recording = true;
     }
@@ -464,16 +600,22 @@ void FrameInterpolation_StopRecord(void) {
 void FrameInterpolation_RecordOpenChild(const void* a, int b) {
     if (!is_recording)
         return;
-    label key = { a, b };
-    auto& m = current_path.back()->children[key];
-    append(Op::OpenChild).open_child = { key, m.size() };
-    current_path.push_back(&m.emplace_back());
+    uint32_t node = (uint32_t)current_recording.nodes.size();
+    append(Op::OpenChild).open_child = { node };
+    Node& child = current_recording.nodes.emplace_back();
+    child.key = { a, b };
+    child.parent = current_path.back();
+    child.stream_begin = (uint32_t)current_recording.stream.size();
+    current_path.push_back(node);
 }
 
 void FrameInterpolation_RecordCloseChild(void) {
     if (!is_recording)
         return;
-    //append(Op::CloseChild);
+    // An unmatched close would end the root node and hide the rest of the frame from interpolation
+    if (current_path.size() <= 1)
+        return;
+    append(Op::CloseChild);
     if (has_inv_actor_mtx && current_path.size() == inv_actor_mtx_path_index) {
         has_inv_actor_mtx = false;
     }
@@ -566,13 +708,13 @@ void FrameInterpolation_RecordMatrixSetTranslateRotateYXZ(f32 translateX, f32 tr
 void FrameInterpolation_RecordMatrixMtxFToMtx(MtxF* src, Mtx* dest) {
     if (!is_recording)
         return;
-    append(Op::MatrixMtxFToMtx).matrix_mtxf_to_mtx = { *src, dest };
+    append(Op::MatrixMtxFToMtx).matrix_mtxf_to_mtx = { *src, dest, current_recording.mtx_slots++ };
 }
 
 void FrameInterpolation_RecordMatrixToMtx(Mtx* dest, char* file, s32 line) {
     if (!is_recording)
         return;
-    auto& d = append(Op::MatrixToMtx).matrix_to_mtx = { dest };
+    auto& d = append(Op::MatrixToMtx).matrix_to_mtx = { dest, current_recording.mtx_slots++ };
     if (has_inv_actor_mtx) {
         d.has_adjusted = true;
         SkinMatrix_MtxFMtxFMult(&inv_actor_mtx, Matrix_GetCurrent(), &d.src);
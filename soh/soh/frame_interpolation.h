@@ -4,9 +4,18 @@
 
 #ifdef __cplusplus
 
-#include <unordered_map>
-
-std::unordered_map<Mtx*, MtxF> FrameInterpolation_Interpolate(float step);
+#include <vector>
+
+// An interpolated matrix, stored at the slot its Mtx was given when the frame was recorded. dest is NULL for slots that
+// were not reached while interpolating.
+struct FrameInterpolationMtx {
+    Mtx* dest;
+    MtxF mtx;
+};
+
+// Interpolates the current frame recording against the previous one. Fills replacements with one entry per slot,
+// resizing it but keeping its storage so that the same vector can be passed every frame.
+void FrameInterpolation_Interpolate(float step, std::vector<FrameInterpolationMtx>& replacements);
 
 extern "C" {
 
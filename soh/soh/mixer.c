@@ -4,6 +4,17 @@
 
 #include "mixer.h"
 
+// The scalar loops below are the reference implementation, the SIMD paths must produce bit-identical output.
+// tests/mixer_simd_test.c checks that. Define MIXER_NO_SIMD to build only the scalar versions.
+// The NEON paths have not been checked on hardware yet, so they are only built when MIXER_ENABLE_NEON is defined.
+#if !defined(MIXER_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define MIXER_SSE2
+#elif !defined(MIXER_NO_SIMD) && defined(MIXER_ENABLE_NEON) && (defined(__ARM_NEON) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define MIXER_NEON
+#endif
+
 #ifndef __clang__
 #pragma GCC optimize ("unroll-loops")
 #endif
@@ -94,6 +105,21 @@ static inline int32_t clamp32(int64_t v) {
     return (int32_t)v;
 }
 
+#if defined(MIXER_SSE2)
+// (int16_t sample * uint16_t vol) >> 16 for each lane. The product always fits in 32 bits, so this is the high half
+// of a signed multiply, corrected for vol being treated as negative when its top bit is set.
+static inline __m128i MixerMulHiSU16(__m128i samples, uint16_t vol) {
+    __m128i hi = _mm_mulhi_epi16(samples, _mm_set1_epi16((int16_t)vol));
+    return (vol & 0x8000) ? _mm_add_epi16(hi, samples) : hi;
+}
+#elif defined(MIXER_NEON)
+static inline int16x8_t MixerMulHiSU16(int16x8_t samples, uint16_t vol) {
+    int32x4_t lo = vmulq_n_s32(vmovl_s16(vget_low_s16(samples)), vol);
+    int32x4_t hi = vmulq_n_s32(vmovl_s16(vget_high_s16(samples)), vol);
+    return vcombine_s16(vshrn_n_s32(lo, 16), vshrn_n_s32(hi, 16));
+}
+#endif
+
 void aClearBufferImpl(uint16_t addr, int nbytes) {
     nbytes = ROUND_UP_16(nbytes);
     memset(BUF_U8(addr), 0, nbytes);
@@ -122,6 +148,25 @@ void aInterleaveImpl(uint16_t dest, uint16_t left, uint16_t right, uint16_t c) {
     int16_t *l = BUF_S16(left);
     int16_t *r = BUF_S16(right);
     int16_t *d = BUF_S16(dest);
+#if defined(MIXER_SSE2)
+    for (; count >= 2; count -= 2) {
+        __m128i lv = _mm_loadu_si128((__m128i*)l);
+        __m128i rv = _mm_loadu_si128((__m128i*)r);
+        _mm_storeu_si128((__m128i*)d, _mm_unpacklo_epi16(lv, rv));
+        _mm_storeu_si128((__m128i*)(d + 8), _mm_unpackhi_epi16(lv, rv));
+        l += 8;
+        r += 8;
+        d += 16;
+    }
+#elif defined(MIXER_NEON)
+    for (; count >= 2; count -= 2) {
+        int16x8x2_t lr = { { vld1q_s16(l), vld1q_s16(r) } };
+        vst2q_s16(d, lr);
+        l += 8;
+        r += 8;
+        d += 16;
+    }
+#endif
     while (count > 0) {
         int16_t l0 = *l++;
         int16_t l1 = *l++;
@@ -283,6 +328,50 @@ void aEnvMixerImpl(uint16_t in_addr, uint16_t n_samples, bool swap_reverb,
     uint16_t vol_wet = rspa.vol_wet;
     uint16_t rate_wet = rspa.rate_wet;
 
+#if defined(MIXER_SSE2)
+    do {
+        __m128i s = _mm_loadu_si128((__m128i*)in);
+        __m128i samples[2];
+        in += 8;
+        for (int j = 0; j < 2; j++) {
+            samples[j] = _mm_xor_si128(MixerMulHiSU16(s, vols[j]), _mm_set1_epi16(negs[j]));
+        }
+        for (int j = 0; j < 2; j++) {
+            __m128i wetSample =
+                _mm_xor_si128(MixerMulHiSU16(samples[swapped[j]], vol_wet), _mm_set1_epi16(negs[2 + j]));
+            _mm_storeu_si128((__m128i*)dry[j], _mm_adds_epi16(_mm_loadu_si128((__m128i*)dry[j]), samples[j]));
+            _mm_storeu_si128((__m128i*)wet[j], _mm_adds_epi16(_mm_loadu_si128((__m128i*)wet[j]), wetSample));
+            dry[j] += 8;
+            wet[j] += 8;
+        }
+        vols[0] += rates[0];
+        vols[1] += rates[1];
+        vol_wet += rate_wet;
+
+        n -= 8;
+    } while (n > 0);
+#elif defined(MIXER_NEON)
+    do {
+        int16x8_t s = vld1q_s16(in);
+        int16x8_t samples[2];
+        in += 8;
+        for (int j = 0; j < 2; j++) {
+            samples[j] = veorq_s16(MixerMulHiSU16(s, vols[j]), vdupq_n_s16(negs[j]));
+        }
+        for (int j = 0; j < 2; j++) {
+            int16x8_t wetSample = veorq_s16(MixerMulHiSU16(samples[swapped[j]], vol_wet), vdupq_n_s16(negs[2 + j]));
+            vst1q_s16(dry[j], vqaddq_s16(vld1q_s16(dry[j]), samples[j]));
+            vst1q_s16(wet[j], vqaddq_s16(vld1q_s16(wet[j]), wetSample));
+            dry[j] += 8;
+            wet[j] += 8;
+        }
+        vols[0] += rates[0];
+        vols[1] += rates[1];
+        vol_wet += rate_wet;
+
+        n -= 8;
+    } while (n > 0);
+#else
     do {
         for (int i = 0; i < 8; i++) {
             int16_t samples[2] = {*in, *in}; in++;
@@ -300,6 +389,7 @@ void aEnvMixerImpl(uint16_t in_addr, uint16_t n_samples, bool swap_reverb,
 
         n -= 8;
     } while (n > 0);
+#endif
 }
 
 void aMixImpl(uint16_t count, int16_t gain, uint16_t in_addr, uint16_t out_addr) {
@@ -309,6 +399,49 @@ void aMixImpl(uint16_t count, int16_t gain, uint16_t in_addr, uint16_t out_addr)
     int i;
     int32_t sample;
 
+#if defined(MIXER_SSE2)
+    if (gain == -0x8000) {
+        for (; nbytes > 0; nbytes -= 16 * sizeof(int16_t), in += 16, out += 16) {
+            for (i = 0; i < 16; i += 8) {
+                __m128i o = _mm_loadu_si128((__m128i*)(out + i));
+                _mm_storeu_si128((__m128i*)(out + i), _mm_subs_epi16(o, _mm_loadu_si128((__m128i*)(in + i))));
+            }
+        }
+    }
+
+    // out * 0x7fff + in * gain as a single multiply-add over interleaved (out, in) pairs
+    __m128i coeffs = _mm_set1_epi32((int32_t)(((uint32_t)(uint16_t)gain << 16) | 0x7fff));
+    __m128i round = _mm_set1_epi32(0x4000);
+    for (; nbytes > 0; nbytes -= 16 * sizeof(int16_t), in += 16, out += 16) {
+        for (i = 0; i < 16; i += 8) {
+            __m128i o = _mm_loadu_si128((__m128i*)(out + i));
+            __m128i v = _mm_loadu_si128((__m128i*)(in + i));
+            __m128i lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(o, v), coeffs), round), 15);
+            __m128i hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(o, v), coeffs), round), 15);
+            _mm_storeu_si128((__m128i*)(out + i), _mm_packs_epi32(lo, hi));
+        }
+    }
+#elif defined(MIXER_NEON)
+    if (gain == -0x8000) {
+        for (; nbytes > 0; nbytes -= 16 * sizeof(int16_t), in += 16, out += 16) {
+            for (i = 0; i < 16; i += 8) {
+                vst1q_s16(out + i, vqsubq_s16(vld1q_s16(out + i), vld1q_s16(in + i)));
+            }
+        }
+    }
+
+    for (; nbytes > 0; nbytes -= 16 * sizeof(int16_t), in += 16, out += 16) {
+        for (i = 0; i < 16; i += 8) {
+            int16x8_t o = vld1q_s16(out + i);
+            int16x8_t v = vld1q_s16(in + i);
+            int32x4_t lo = vmlal_n_s16(vmull_n_s16(vget_low_s16(o), 0x7fff), vget_low_s16(v), gain);
+            int32x4_t hi = vmlal_n_s16(vmull_n_s16(vget_high_s16(o), 0x7fff), vget_high_s16(v), gain);
+            lo = vshrq_n_s32(vaddq_s32(lo, vdupq_n_s32(0x4000)), 15);
+            hi = vshrq_n_s32(vaddq_s32(hi, vdupq_n_s32(0x4000)), 15);
+            vst1q_s16(out + i, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+        }
+    }
+#else
     if (gain == -0x8000) {
         while (nbytes > 0) {
             for (i = 0; i < 16; i++) {
@@ -327,6 +460,7 @@ void aMixImpl(uint16_t count, int16_t gain, uint16_t in_addr, uint16_t out_addr)
 
         nbytes -= 16 * sizeof(int16_t);
     }
+#endif
 }
 
 void aS8DecImpl(uint8_t flags, ADPCM_STATE state) {
@@ -342,6 +476,19 @@ void aS8DecImpl(uint8_t flags, ADPCM_STATE state) {
     }
     out += 16;
 
+#if defined(MIXER_SSE2)
+    for (; nbytes > 0; nbytes -= 16 * sizeof(int16_t), in += 16, out += 16) {
+        __m128i bytes = _mm_loadu_si128((__m128i*)in);
+        _mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi8(_mm_setzero_si128(), bytes));
+        _mm_storeu_si128((__m128i*)(out + 8), _mm_unpackhi_epi8(_mm_setzero_si128(), bytes));
+    }
+#elif defined(MIXER_NEON)
+    for (; nbytes > 0; nbytes -= 16 * sizeof(int16_t), in += 16, out += 16) {
+        uint8x16_t bytes = vld1q_u8(in);
+        vst1q_s16(out, vreinterpretq_s16_u16(vshll_n_u8(vget_low_u8(bytes), 8)));
+        vst1q_s16(out + 8, vreinterpretq_s16_u16(vshll_n_u8(vget_high_u8(bytes), 8)));
+    }
+#else
     while (nbytes > 0) {
         *out++ = (int16_t)(*in++ << 8);
         *out++ = (int16_t)(*in++ << 8);
@@ -362,6 +509,7 @@ void aS8DecImpl(uint8_t flags, ADPCM_STATE state) {
 
         nbytes -= 16 * sizeof(int16_t);
     }
+#endif
 
     memcpy(state, out - 16, 16 * sizeof(int16_t));
 }
@@ -371,6 +519,28 @@ void aAddMixerImpl(uint16_t count, uint16_t in_addr, uint16_t out_addr) {
     int16_t *out = BUF_S16(out_addr);
     int nbytes = ROUND_UP_64(ROUND_DOWN_16(count));
 
+#if defined(MIXER_SSE2)
+    do {
+        for (int i = 0; i < 16; i += 8) {
+            __m128i o = _mm_loadu_si128((__m128i*)(out + i));
+            _mm_storeu_si128((__m128i*)(out + i), _mm_adds_epi16(o, _mm_loadu_si128((__m128i*)(in + i))));
+        }
+        in += 16;
+        out += 16;
+
+        nbytes -= 16 * sizeof(int16_t);
+    } while (nbytes > 0);
+#elif defined(MIXER_NEON)
+    do {
+        for (int i = 0; i < 16; i += 8) {
+            vst1q_s16(out + i, vqaddq_s16(vld1q_s16(out + i), vld1q_s16(in + i)));
+        }
+        in += 16;
+        out += 16;
+
+        nbytes -= 16 * sizeof(int16_t);
+    } while (nbytes > 0);
+#else
     do {
         *out = clamp16(*out + *in++); out++;
         *out = clamp16(*out + *in++); out++;
@@ -391,6 +561,7 @@ void aAddMixerImpl(uint16_t count, uint16_t in_addr, uint16_t out_addr) {
 
         nbytes -= 16 * sizeof(int16_t);
     } while (nbytes > 0);
+#endif
 }
 
 void aDuplicateImpl(uint16_t count, uint16_t in_addr, uint16_t out_addr) {
@@ -10,6 +10,7 @@
 extern "C" void Play_InitScene(PlayState * play, s32 spawn);
 extern "C" void Play_InitEnvironment(PlayState * play, s16 skyboxId);
 void OTRPlay_InitScene(PlayState* play, s32 spawn);
+extern "C" void ResourceMgr_ClearResolvedResourceCache();
 s32 OTRScene_ExecuteCommands(PlayState* play, Ship::Scene* scene);
 
 //Ship::OTRResource* OTRPlay_LoadFile(PlayState* play, RomFile* file) {
@@ -27,6 +28,9 @@ extern "C" void OTRPlay_SpawnScene(PlayState* play, s32 sceneNum, s32 spawn) {
     play->sceneNum = sceneNum;
     play->sceneConfig = scene->config;
 
+    // Drop the previous scene's resolved lookups so the cache doesn't keep its resources alive
+    ResourceMgr_ClearResolvedResourceCache();
+
     //osSyncPrintf("\nSCENE SIZE %fK\n", (scene->sceneFile.vromEnd - scene->sceneFile.vromStart) / 1024.0f);
 
     std::string sceneVersion;
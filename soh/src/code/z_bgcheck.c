@@ -2,6 +2,10 @@
 #include "vt.h"
 
 #include <soh/OTRGlobals.h>
+#include "soh/Enhancements/cvar_cache.h"
+
+#include <stdlib.h>
+#include <string.h>
 
 #define SS_NULL 0xFFFF
 
@@ -20,6 +24,10 @@
 #define BGCHECK_IGNORE_WALL (1 << 1)
 #define BGCHECK_IGNORE_FLOOR (1 << 2)
 
+static CVarCachedInt sNoClip = CVAR_CACHED_INT("gNoClip", 0);
+static CVarCachedInt sClimbEverything = CVAR_CACHED_INT("gClimbEverything", 0);
+static CVarCachedInt sHookshotEverything = CVAR_CACHED_INT("gHookshotEverything", 0);
+
 // poly exclusion flags (xpFlags)
 #define COLPOLY_IGNORE_NONE 0
 #define COLPOLY_IGNORE_CAMERA (1 << 0)
@@ -1435,6 +1443,185 @@ u32 BgCheck_InitializeStaticLookup(CollisionContext* colCtx, PlayState* play, St
     return colCtx->polyNodes.count * sizeof(SSNode);
 }
 
+/**
+ * Copies the nodes of `ssList` from `srcTbl` to `nodeList` starting at `*nextIdx`, so that every node is followed by
+ * the next one in memory. Returns false if the list doesn't fit.
+ */
+static s32 StaticLookup_CompactSSList(SSNodeList* nodeList, SSNode* srcTbl, SSList* ssList, u16* nextIdx) {
+    u16 curIdx = ssList->head;
+    u16 newHead = *nextIdx;
+
+    if (curIdx == SS_NULL) {
+        return true;
+    }
+    while (curIdx != SS_NULL) {
+        if (*nextIdx >= nodeList->count) {
+            return false;
+        }
+        nodeList->tbl[*nextIdx].polyId = srcTbl[curIdx].polyId;
+        nodeList->tbl[*nextIdx].next = *nextIdx + 1;
+        curIdx = srcTbl[curIdx].next;
+        (*nextIdx)++;
+    }
+    nodeList->tbl[*nextIdx - 1].next = SS_NULL;
+    ssList->head = newHead;
+    return true;
+}
+
+/**
+ * Results of the static queries StaticLookup_RunQueries makes at one position
+ */
+typedef struct {
+    f32 floorY;
+    CollisionPoly* floorPoly;
+    s32 wallHit;
+    f32 wallX;
+    f32 wallZ;
+    CollisionPoly* wallPoly;
+    s32 ceilingHit;
+    f32 ceilingY;
+    CollisionPoly* ceilingPoly;
+    s32 sphHit;
+    CollisionPoly* sphPoly;
+    s32 lineHit;
+    Vec3f linePos;
+    CollisionPoly* linePoly;
+    f32 lineDistSq;
+} StaticLookupQueryResults;
+
+/**
+ * Clears the polyCheckTbl entries of the polys in `ssList`, which is cheaper than resetting the whole table between
+ * line tests that only touch one subdivision
+ */
+static void StaticLookup_ClearPolyChecks(SSList* ssList, CollisionContext* colCtx) {
+    u16 curIdx;
+
+    for (curIdx = ssList->head; curIdx != SS_NULL; curIdx = colCtx->polyNodes.tbl[curIdx].next) {
+        colCtx->polyNodes.polyCheckTbl[colCtx->polyNodes.tbl[curIdx].polyId] = false;
+    }
+}
+
+/**
+ * Runs a floor raycast, a wall check, a ceiling check, a sphere check and a line test within `lookup` at `pos`, with
+ * the line test going from `pos` to `lineEnd`. These walk every list of the subdivision the way the game's queries do.
+ */
+static void StaticLookup_RunQueries(StaticLookup* lookup, CollisionContext* colCtx, Vec3f* pos, Vec3f* lineEnd,
+                                    StaticLookupQueryResults* results) {
+    Vec3f posB = *lineEnd;
+
+    bzero(results, sizeof(StaticLookupQueryResults));
+    results->floorY = BgCheck_RaycastFloorStatic(lookup, colCtx, COLPOLY_IGNORE_NONE, &results->floorPoly, pos, 0xF,
+                                                 1.0f, BGCHECK_Y_MIN);
+    results->wallHit = BgCheck_SphVsStaticWall(lookup, colCtx, COLPOLY_IGNORE_NONE, &results->wallX, &results->wallZ,
+                                               pos, 26.0f, &results->wallPoly);
+    results->ceilingHit = BgCheck_CheckStaticCeiling(lookup, COLPOLY_IGNORE_NONE, colCtx, &results->ceilingY, pos,
+                                                     40.0f, &results->ceilingPoly);
+    results->sphHit = BgCheck_SphVsFirstStaticPoly(lookup, COLPOLY_IGNORE_NONE, colCtx, pos, 26.0f, &results->sphPoly,
+                                                   BGCHECK_IGNORE_NONE);
+    results->lineDistSq = Math3D_Vec3fDistSq(pos, &posB);
+    results->lineHit =
+        BgCheck_CheckLineInSubdivision(lookup, colCtx, COLPOLY_IGNORE_NONE, COLPOLY_IGNORE_NONE, pos, &posB,
+                                       &results->linePos, &results->linePoly, 1.0f, &results->lineDistSq,
+                                       BGCHECK_CHECK_ALL & ~BGCHECK_CHECK_ONE_FACE);
+    StaticLookup_ClearPolyChecks(&lookup->floor, colCtx);
+    StaticLookup_ClearPolyChecks(&lookup->wall, colCtx);
+    StaticLookup_ClearPolyChecks(&lookup->ceiling, colCtx);
+}
+
+/**
+ * Returns true if every subdivision answers the same static queries the same way with the current SSNode table and
+ * `lookupTbl` as with `srcTbl` and `srcLookupTbl`. Each subdivision is probed at a grid of points inside it, with line
+ * tests across it, so that early outs that depend on list order are exercised as well.
+ */
+static s32 StaticLookup_QueriesMatch(CollisionContext* colCtx, StaticLookup* lookupTbl, SSNode* srcTbl,
+                                     StaticLookup* srcLookupTbl) {
+    static const f32 sFractions[] = { 0.1f, 0.5f, 0.9f };
+    SSNode* tbl = colCtx->polyNodes.tbl;
+    StaticLookupQueryResults results;
+    StaticLookupQueryResults srcResults;
+    Vec3f pos;
+    Vec3f lineEnd;
+    s32 x, y, z;
+    s32 i, j, k;
+    s32 match = true;
+
+    BgCheck_ResetPolyCheckTbl(&colCtx->polyNodes, colCtx->colHeader->numPolygons);
+    for (z = 0; z < colCtx->subdivAmount.z && match; z++) {
+        for (y = 0; y < colCtx->subdivAmount.y && match; y++) {
+            for (x = 0; x < colCtx->subdivAmount.x && match; x++) {
+                s32 lookupIdx = x + y * colCtx->subdivAmount.x + z * colCtx->subdivAmount.x * colCtx->subdivAmount.y;
+
+                for (i = 0; i < ARRAY_COUNT(sFractions) && match; i++) {
+                    for (j = 0; j < ARRAY_COUNT(sFractions) && match; j++) {
+                        for (k = 0; k < ARRAY_COUNT(sFractions) && match; k++) {
+                            pos.x = colCtx->minBounds.x + (x + sFractions[i]) * colCtx->subdivLength.x;
+                            pos.y = colCtx->minBounds.y + (y + sFractions[j]) * colCtx->subdivLength.y;
+                            pos.z = colCtx->minBounds.z + (z + sFractions[k]) * colCtx->subdivLength.z;
+                            lineEnd.x = colCtx->minBounds.x + (x + 1.0f - sFractions[i]) * colCtx->subdivLength.x;
+                            lineEnd.y = colCtx->minBounds.y + (y + 1.0f - sFractions[j]) * colCtx->subdivLength.y;
+                            lineEnd.z = colCtx->minBounds.z + (z + 1.0f - sFractions[k]) * colCtx->subdivLength.z;
+
+                            colCtx->polyNodes.tbl = tbl;
+                            StaticLookup_RunQueries(&lookupTbl[lookupIdx], colCtx, &pos, &lineEnd, &results);
+                            colCtx->polyNodes.tbl = srcTbl;
+                            StaticLookup_RunQueries(&srcLookupTbl[lookupIdx], colCtx, &pos, &lineEnd, &srcResults);
+                            match = memcmp(&results, &srcResults, sizeof(StaticLookupQueryResults)) == 0;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    colCtx->polyNodes.tbl = tbl;
+    return match;
+}
+
+/**
+ * Reorders the static SSNode table so that each floor, wall and ceiling list of every subdivision occupies a
+ * contiguous run of nodes, in the order the lists are traversed. The subdivision grid and the poly order within each
+ * list are unchanged, so queries visit the same polys in the same order but step through memory sequentially. The
+ * compacted table is checked with StaticLookup_QueriesMatch, and the original table is kept if any query differs.
+ */
+void BgCheck_CompactStaticLookup(CollisionContext* colCtx, StaticLookup* lookupTbl) {
+    s32 numLookups = colCtx->subdivAmount.x * colCtx->subdivAmount.y * colCtx->subdivAmount.z;
+    SSNodeList* nodeList = &colCtx->polyNodes;
+    StaticLookup* srcLookupTbl;
+    SSNode* srcTbl;
+    u16 nextIdx = 0;
+    s32 success = true;
+    s32 i;
+
+    if (nodeList->count == 0) {
+        return;
+    }
+    srcTbl = malloc(nodeList->count * sizeof(SSNode));
+    srcLookupTbl = malloc(numLookups * sizeof(StaticLookup));
+    if (srcTbl == NULL || srcLookupTbl == NULL) {
+        free(srcTbl);
+        free(srcLookupTbl);
+        return;
+    }
+    memcpy(srcTbl, nodeList->tbl, nodeList->count * sizeof(SSNode));
+    memcpy(srcLookupTbl, lookupTbl, numLookups * sizeof(StaticLookup));
+
+    for (i = 0; i < numLookups && success; i++) {
+        success = StaticLookup_CompactSSList(nodeList, srcTbl, &lookupTbl[i].floor, &nextIdx) &&
+                  StaticLookup_CompactSSList(nodeList, srcTbl, &lookupTbl[i].wall, &nextIdx) &&
+                  StaticLookup_CompactSSList(nodeList, srcTbl, &lookupTbl[i].ceiling, &nextIdx);
+    }
+    if (success) {
+        success = StaticLookup_QueriesMatch(colCtx, lookupTbl, srcTbl, srcLookupTbl);
+    }
+
+    if (!success) {
+        osSyncPrintf("BgCheck_CompactStaticLookup(): compacted lookup differs, keeping the original\n");
+        memcpy(nodeList->tbl, srcTbl, nodeList->count * sizeof(SSNode));
+        memcpy(lookupTbl, srcLookupTbl, numLookups * sizeof(StaticLookup));
+    }
+    free(srcTbl);
+    free(srcLookupTbl);
+}
+
 /**
  * Is current scene a SPOT scene
  */
@@ -1627,6 +1814,10 @@ void BgCheck_Allocate(CollisionContext* colCtx, PlayState* play, CollisionHeader
     SSNodeList_Alloc(play, &colCtx->polyNodes, tblMax, colCtx->colHeader->numPolygons);
 
     lookupTblMemSize = BgCheck_InitializeStaticLookup(colCtx, play, colCtx->lookupTbl);
+    // A single global setting, read on every scene load, so toggling it applies from the next scene on
+    if (CVarGetInteger("gCompactStaticCollision", 0)) {
+        BgCheck_CompactStaticLookup(colCtx, colCtx->lookupTbl);
+    }
     osSyncPrintf(VT_FGCOL(GREEN));
     osSyncPrintf("/*---結局 BG使用サイズ %dbyte---*/\n", memSize + lookupTblMemSize);
     osSyncPrintf(VT_RST);
@@ -1898,7 +2089,7 @@ s32 BgCheck_CheckWallImpl(CollisionContext* colCtx, u16 xpFlags, Vec3f* posResul
     s32 bgId2;
     f32 nx, ny, nz; // unit normal of polygon
 
-    if (CVarGetInteger("gNoClip", 0) != 0) {
+    if (CVarCache_GetInteger(&sNoClip) != 0) {
         return false;
     }
 
@@ -2543,6 +2734,7 @@ void BgActor_Initialize(PlayState* play, BgActor* bgActor) {
     DynaLookup_ResetVtxStartIndex(&bgActor->vtxStartIndex);
     bgActor->boundingSphere.center.x = bgActor->boundingSphere.center.y = bgActor->boundingSphere.center.z = 0;
     bgActor->boundingSphere.radius = 0;
+    bgActor->lookupCache.valid = false;
 }
 
 /**
@@ -2619,6 +2811,7 @@ s32 DynaPoly_IsBgIdBgActor(s32 bgId) {
  */
 void DynaPoly_Init(PlayState* play, DynaCollisionContext* dyna) {
     dyna->bitFlag = DYNAPOLY_INVALIDATE_LOOKUP;
+    dyna->setupCount = 0;
     DynaPoly_NullPolyList(&dyna->polyList);
     DynaPoly_NullVtxList(&dyna->vtxList);
     DynaSSNodeList_Initialize(play, &dyna->polyNodes);
@@ -2782,6 +2975,9 @@ void DynaPoly_ExpandSRT(PlayState* play, DynaCollisionContext* dyna, s32 bgId, s
     Vec3f vtxB;
     Vec3f vtxC;
     Vec3f newNormal;
+    f32 mtxXX, mtxXY, mtxXZ, mtxXW;
+    f32 mtxYX, mtxYY, mtxYZ, mtxYW;
+    f32 mtxZX, mtxZY, mtxZZ, mtxZW;
 
     pbgdata = dyna->bgActors[bgId].colHeader;
     sphere = &dyna->bgActors[bgId].boundingSphere;
@@ -2816,7 +3012,26 @@ void DynaPoly_ExpandSRT(PlayState* play, DynaCollisionContext* dyna, s32 bgId, s
 
     if (!(dyna->bitFlag & DYNAPOLY_INVALIDATE_LOOKUP) &&
         (BgActor_IsTransformUnchanged(&dyna->bgActors[bgId]) == true)) {
+        DynaLookupCache* cache = &dyna->bgActors[bgId].lookupCache;
         s32 pi;
+
+        if (cache->valid && cache->setupCount == dyna->setupCount - 1 && cache->colHeader == pbgdata &&
+            cache->polyStartIndex == *polyStartIndex && cache->vtxStartIndex == *vtxStartIndex &&
+            cache->nodeStartIndex == dyna->polyNodes.count &&
+            cache->noCeiling == (dyna->bgActorFlags[bgId] & 8)) {
+            // The polys and the nodes built from them last frame are untouched, so the lists would come out the same
+            dyna->bgActors[bgId].dynaLookup.ceiling = cache->ceiling;
+            dyna->bgActors[bgId].dynaLookup.wall = cache->wall;
+            dyna->bgActors[bgId].dynaLookup.floor = cache->floor;
+            dyna->polyNodes.count += cache->nodeCount;
+            cache->setupCount = dyna->setupCount;
+
+            *polyStartIndex += pbgdata->numPolygons;
+            *vtxStartIndex += pbgdata->numVertices;
+            return;
+        }
+
+        cache->nodeStartIndex = dyna->polyNodes.count;
         for (pi = *polyStartIndex; pi < *polyStartIndex + pbgdata->numPolygons; pi++) {
             CollisionPoly* poly = &dyna->polyList[pi];
             s16 normalY = poly->normal.y;
@@ -2836,9 +3051,23 @@ void DynaPoly_ExpandSRT(PlayState* play, DynaCollisionContext* dyna, s32 bgId, s
             }
         }
 
+        // Nodes past the end of the table were never written, so an overflowing build can't be reused
+        cache->valid = dyna->polyNodes.count <= dyna->polyNodes.max;
+        cache->noCeiling = dyna->bgActorFlags[bgId] & 8;
+        cache->polyStartIndex = *polyStartIndex;
+        cache->vtxStartIndex = *vtxStartIndex;
+        cache->nodeCount = dyna->polyNodes.count - cache->nodeStartIndex;
+        cache->setupCount = dyna->setupCount;
+        cache->colHeader = pbgdata;
+        cache->ceiling = dyna->bgActors[bgId].dynaLookup.ceiling;
+        cache->wall = dyna->bgActors[bgId].dynaLookup.wall;
+        cache->floor = dyna->bgActors[bgId].dynaLookup.floor;
+
         *polyStartIndex += pbgdata->numPolygons;
         *vtxStartIndex += pbgdata->numVertices;
     } else {
+        dyna->bgActors[bgId].lookupCache.valid = false;
+
         SkinMatrix_SetTranslateRotateYXZScale(
             &mtx, dyna->bgActors[bgId].curTransform.scale.x, dyna->bgActors[bgId].curTransform.scale.y,
             dyna->bgActors[bgId].curTransform.scale.z, dyna->bgActors[bgId].curTransform.rot.x,
@@ -2848,11 +3077,27 @@ void DynaPoly_ExpandSRT(PlayState* play, DynaCollisionContext* dyna, s32 bgId, s
 
         numVtxInverse = 1.0f / pbgdata->numVertices;
         newCenterPoint.x = newCenterPoint.y = newCenterPoint.z = 0.0f;
+        // Same arithmetic as SkinMatrix_Vec3fMtxFMultXYZ, with the matrix held in locals across the whole mesh
+        // instead of being reloaded through a call for every vertex
+        mtxXX = mtx.xx;
+        mtxXY = mtx.xy;
+        mtxXZ = mtx.xz;
+        mtxXW = mtx.xw;
+        mtxYX = mtx.yx;
+        mtxYY = mtx.yy;
+        mtxYZ = mtx.yz;
+        mtxYW = mtx.yw;
+        mtxZX = mtx.zx;
+        mtxZY = mtx.zy;
+        mtxZZ = mtx.zz;
+        mtxZW = mtx.zw;
         for (i = 0; i < pbgdata->numVertices; i++) {
             Vec3f vtx;
             Vec3f vtxT; // Vtx after mtx transform
             Math_Vec3s_ToVec3f(&vtx, &pbgdata->vtxList[i]);
-            SkinMatrix_Vec3fMtxFMultXYZ(&mtx, &vtx, &vtxT);
+            vtxT.x = mtxXW + ((vtx.x * mtxXX) + (vtx.y * mtxXY) + (vtx.z * mtxXZ));
+            vtxT.y = mtxYW + ((vtx.x * mtxYX) + (vtx.y * mtxYY) + (vtx.z * mtxYZ));
+            vtxT.z = mtxZW + ((vtx.x * mtxZX) + (vtx.y * mtxZY) + (vtx.z * mtxZZ));
             BgCheck_Vec3fToVec3s(&dyna->vtxList[*vtxStartIndex + i], &vtxT);
 
             if (i == 0) {
@@ -2966,6 +3211,7 @@ void DynaPoly_Setup(PlayState* play, DynaCollisionContext* dyna) {
     s32 i;
 
     DynaSSNodeList_ResetCount(&dyna->polyNodes);
+    dyna->setupCount++;
 
     for (i = 0; i < BG_ACTOR_MAX; i++) {
         DynaLookup_ResetLists(&dyna->bgActors[i].dynaLookup);
@@ -4021,7 +4267,7 @@ u32 func_80041D94(CollisionContext* colCtx, CollisionPoly* poly, s32 bgId) {
  * SurfaceType Get Wall Flags
  */
 s32 func_80041DB8(CollisionContext* colCtx, CollisionPoly* poly, s32 bgId) {
-    if (CVarGetInteger("gClimbEverything", 0) != 0) {
+    if (CVarCache_GetInteger(&sClimbEverything) != 0) {
         return (1 << 3) | D_80119D90[func_80041D94(colCtx, poly, bgId)];
     } else {
         return D_80119D90[func_80041D94(colCtx, poly, bgId)];
@@ -4118,7 +4364,7 @@ u32 SurfaceType_GetEcho(CollisionContext* colCtx, CollisionPoly* poly, s32 bgId)
  * SurfaceType Is Hookshot Surface
  */
 u32 SurfaceType_IsHookshotSurface(CollisionContext* colCtx, CollisionPoly* poly, s32 bgId) {
-    return CVarGetInteger("gHookshotEverything", 0) || SurfaceType_GetData(colCtx, poly, bgId, 1) >> 17 & 1;
+    return CVarCache_GetInteger(&sHookshotEverything) || SurfaceType_GetData(colCtx, poly, bgId, 1) >> 17 & 1;
 }
 
 /**
@@ -1,6 +1,10 @@
 #include "global.h"
 #include "vt.h"
 #include "overlays/effects/ovl_Effect_Ss_HitMark/z_eff_ss_hitmark.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+#include <float.h>
+#include <stdlib.h>
 
 typedef s32 (*ColChkResetFunc)(PlayState*, Collider*);
 typedef void (*ColChkBloodFunc)(PlayState*, Collider*, Vec3f*);
@@ -1034,13 +1038,40 @@ s32 Collider_ResetLineOC(PlayState* play, OcLine* line) {
  */
 void CollisionCheck_InitContext(PlayState* play, CollisionCheckContext* colChkCtx) {
     colChkCtx->sacFlags = 0;
+    colChkCtx->colAT = colChkCtx->colATBuffer;
+    colChkCtx->colAC = colChkCtx->colACBuffer;
+    colChkCtx->colOC = colChkCtx->colOCBuffer;
+    colChkCtx->colATCapacity = ARRAY_COUNT(colChkCtx->colATBuffer);
+    colChkCtx->colACCapacity = ARRAY_COUNT(colChkCtx->colACBuffer);
+    colChkCtx->colOCCapacity = ARRAY_COUNT(colChkCtx->colOCBuffer);
     CollisionCheck_ClearContext(play, colChkCtx);
     AREG(21) = true;
     AREG(22) = true;
     AREG(23) = true;
 }
 
+/**
+ * Frees the collider lists that grew into the zelda arena and points the context back at its own buffers.
+ */
 void CollisionCheck_DestroyContext(PlayState* play, CollisionCheckContext* colChkCtx) {
+    if (colChkCtx->colAT != colChkCtx->colATBuffer) {
+        ZELDA_ARENA_FREE_DEBUG(colChkCtx->colAT);
+        colChkCtx->colAT = colChkCtx->colATBuffer;
+        colChkCtx->colATCapacity = ARRAY_COUNT(colChkCtx->colATBuffer);
+    }
+    if (colChkCtx->colAC != colChkCtx->colACBuffer) {
+        ZELDA_ARENA_FREE_DEBUG(colChkCtx->colAC);
+        colChkCtx->colAC = colChkCtx->colACBuffer;
+        colChkCtx->colACCapacity = ARRAY_COUNT(colChkCtx->colACBuffer);
+    }
+    if (colChkCtx->colOC != colChkCtx->colOCBuffer) {
+        ZELDA_ARENA_FREE_DEBUG(colChkCtx->colOC);
+        colChkCtx->colOC = colChkCtx->colOCBuffer;
+        colChkCtx->colOCCapacity = ARRAY_COUNT(colChkCtx->colOCBuffer);
+    }
+    colChkCtx->colATCount = 0;
+    colChkCtx->colACCount = 0;
+    colChkCtx->colOCCount = 0;
 }
 
 /**
@@ -1055,15 +1086,15 @@ void CollisionCheck_ClearContext(PlayState* play, CollisionCheckContext* colChkC
         colChkCtx->colACCount = 0;
         colChkCtx->colOCCount = 0;
         colChkCtx->colLineCount = 0;
-        for (col = colChkCtx->colAT; col < colChkCtx->colAT + COLLISION_CHECK_AT_MAX; col++) {
+        for (col = colChkCtx->colAT; col < colChkCtx->colAT + colChkCtx->colATCapacity; col++) {
             *col = NULL;
         }
 
-        for (col = colChkCtx->colAC; col < colChkCtx->colAC + COLLISION_CHECK_AC_MAX; col++) {
+        for (col = colChkCtx->colAC; col < colChkCtx->colAC + colChkCtx->colACCapacity; col++) {
             *col = NULL;
         }
 
-        for (col = colChkCtx->colOC; col < colChkCtx->colOC + COLLISION_CHECK_OC_MAX; col++) {
+        for (col = colChkCtx->colOC; col < colChkCtx->colOC + colChkCtx->colOCCapacity; col++) {
             *col = NULL;
         }
 
@@ -1163,6 +1194,47 @@ void CollisionCheck_DrawCollision(PlayState* play, CollisionCheckContext* colChk
     }
 }
 
+static CVarCachedInt sRaiseColliderLimits = CVAR_CACHED_INT("gRaiseColliderLimits", 0);
+
+/**
+ * Makes room for a collider at index count of a collider list, returning false if it has to be dropped. Lists hold
+ * the original number of colliders, max. With "gRaiseColliderLimits" enabled a full list doubles in size instead. The
+ * grown list is allocated from the zelda arena so that savestates keep it, and is freed in
+ * CollisionCheck_DestroyContext.
+ */
+static s32 CollisionCheck_ReserveSlot(Collider*** list, s32* capacity, Collider** buffer, s32 max, s32 count) {
+    Collider** grown;
+
+    if (!CVarCache_GetInteger(&sRaiseColliderLimits)) {
+        return count < max;
+    }
+    if (count < *capacity) {
+        return true;
+    }
+    grown = ZELDA_ARENA_MALLOC_DEBUG(*capacity * 2 * sizeof(Collider*));
+    if (grown == NULL) {
+        return false;
+    }
+    memcpy(grown, *list, count * sizeof(Collider*));
+    memset(grown + count, 0, (*capacity * 2 - count) * sizeof(Collider*));
+    if (*list != buffer) {
+        ZELDA_ARENA_FREE_DEBUG(*list);
+    }
+    *list = grown;
+    *capacity *= 2;
+    return true;
+}
+
+#define CollisionCheck_ReserveATSlot(colChkCtx)                                                               \
+    CollisionCheck_ReserveSlot(&(colChkCtx)->colAT, &(colChkCtx)->colATCapacity, (colChkCtx)->colATBuffer, \
+                               COLLISION_CHECK_AT_MAX, (colChkCtx)->colATCount)
+#define CollisionCheck_ReserveACSlot(colChkCtx)                                                               \
+    CollisionCheck_ReserveSlot(&(colChkCtx)->colAC, &(colChkCtx)->colACCapacity, (colChkCtx)->colACBuffer, \
+                               COLLISION_CHECK_AC_MAX, (colChkCtx)->colACCount)
+#define CollisionCheck_ReserveOCSlot(colChkCtx)                                                               \
+    CollisionCheck_ReserveSlot(&(colChkCtx)->colOC, &(colChkCtx)->colOCCapacity, (colChkCtx)->colOCBuffer, \
+                               COLLISION_CHECK_OC_MAX, (colChkCtx)->colOCCount)
+
 static ColChkResetFunc sATResetFuncs[] = {
     Collider_ResetJntSphAT,
     Collider_ResetCylinderAT,
@@ -1185,7 +1257,7 @@ s32 CollisionCheck_SetAT(PlayState* play, CollisionCheckContext* colChkCtx, Coll
     if (collider->actor != NULL && collider->actor->update == NULL) {
         return -1;
     }
-    if (colChkCtx->colATCount >= COLLISION_CHECK_AT_MAX) {
+    if (!CollisionCheck_ReserveATSlot(colChkCtx)) {
         // "Index exceeded and cannot add more"
         osSyncPrintf("CollisionCheck_setAT():インデックスがオーバーして追加不能\n");
         return -1;
@@ -1221,7 +1293,7 @@ s32 CollisionCheck_SetAT_SAC(PlayState* play, CollisionCheckContext* colChkCtx,
         }
         colChkCtx->colAT[index] = collider;
     } else {
-        if (!(colChkCtx->colATCount < COLLISION_CHECK_AT_MAX)) {
+        if (!CollisionCheck_ReserveATSlot(colChkCtx)) {
             // "Index exceeded and cannot add more"
             osSyncPrintf("CollisionCheck_setAT():インデックスがオーバーして追加不能\n");
             return -1;
@@ -1254,7 +1326,7 @@ s32 CollisionCheck_SetAC(PlayState* play, CollisionCheckContext* colChkCtx, Coll
     if (collider->actor != NULL && collider->actor->update == NULL) {
         return -1;
     }
-    if (colChkCtx->colACCount >= COLLISION_CHECK_AC_MAX) {
+    if (!CollisionCheck_ReserveACSlot(colChkCtx)) {
         // "Index exceeded and cannot add more"
         osSyncPrintf("CollisionCheck_setAC():インデックスがオーバして追加不能\n");
         return -1;
@@ -1290,7 +1362,7 @@ s32 CollisionCheck_SetAC_SAC(PlayState* play, CollisionCheckContext* colChkCtx,
         }
         colChkCtx->colAC[index] = collider;
     } else {
-        if (!(colChkCtx->colACCount < COLLISION_CHECK_AC_MAX)) {
+        if (!CollisionCheck_ReserveACSlot(colChkCtx)) {
             // "Index exceeded and cannot add more"
             osSyncPrintf("CollisionCheck_setAC():インデックスがオーバして追加不能\n");
             return -1;
@@ -1325,7 +1397,7 @@ s32 CollisionCheck_SetOC(PlayState* play, CollisionCheckContext* colChkCtx, Coll
     if (collider->actor != NULL && collider->actor->update == NULL) {
         return -1;
     }
-    if (colChkCtx->colOCCount >= COLLISION_CHECK_OC_MAX) {
+    if (!CollisionCheck_ReserveOCSlot(colChkCtx)) {
         // "Index exceeded and cannot add more"
         osSyncPrintf("CollisionCheck_setOC():インデックスがオーバして追加不能\n");
         return -1;
@@ -1360,9 +1432,12 @@ s32 CollisionCheck_SetOC_SAC(PlayState* play, CollisionCheckContext* colChkCtx,
             return -1;
         }
         //! @bug Should be colOC
-        colChkCtx->colAT[index] = collider;
+        // The OC list can outgrow the AT list, so don't write past the end of it
+        if (index < colChkCtx->colATCapacity) {
+            colChkCtx->colAT[index] = collider;
+        }
     } else {
-        if (!(colChkCtx->colOCCount < COLLISION_CHECK_OC_MAX)) {
+        if (!CollisionCheck_ReserveOCSlot(colChkCtx)) {
             // "Index exceeded and cannot add more"
             osSyncPrintf("CollisionCheck_setOC():インデックスがオーバして追加不能\n");
             return -1;
@@ -2591,13 +2666,186 @@ static ColChkVsFunc sACVsFuncs[4][4] = {
 };
 
 /**
- * Iterates through all AC colliders, performing AC collisions with the AT collider.
+ * Axis aligned box enclosing every element of a collider, used to find the collider pairs that can possibly overlap
+ * before running the exact checks above.
+ */
+typedef struct {
+    Vec3f min;
+    Vec3f max;
+} ColChkBounds;
+
+/**
+ * Sweep and prune over one collider list. Bounds are indexed like the list, sorted holds the list indices ordered
+ * by min.x and candidates receives query results. The arrays are scratch space rebuilt every frame, so they grow with
+ * the collider lists and are never freed.
+ */
+typedef struct {
+    s32 count;
+    s32 capacity;
+    ColChkBounds* bounds;
+    s32* sorted;
+    s32* candidates;
+} ColChkBroadphase;
+
+static ColChkBroadphase sACBroadphase;
+static ColChkBroadphase sOCBroadphase;
+
+// Margin added to every box so that colliders that only touch are still checked
+#define COLCHK_BOUNDS_MARGIN 1.0f
+
+static void CollisionCheck_BoundsAddPoint(ColChkBounds* bounds, f32 x, f32 y, f32 z, f32 radius) {
+    bounds->min.x = CLAMP_MAX(bounds->min.x, x - radius);
+    bounds->min.y = CLAMP_MAX(bounds->min.y, y - radius);
+    bounds->min.z = CLAMP_MAX(bounds->min.z, z - radius);
+    bounds->max.x = CLAMP_MIN(bounds->max.x, x + radius);
+    bounds->max.y = CLAMP_MIN(bounds->max.y, y + radius);
+    bounds->max.z = CLAMP_MIN(bounds->max.z, z + radius);
+}
+
+/**
+ * Computes the bounds of every element of the collider. A collider without elements gets an empty box that overlaps
+ * nothing.
+ */
+static void CollisionCheck_GetBounds(Collider* collider, ColChkBounds* bounds) {
+    s32 i;
+    s32 j;
+
+    bounds->min.x = bounds->min.y = bounds->min.z = FLT_MAX;
+    bounds->max.x = bounds->max.y = bounds->max.z = -FLT_MAX;
+    if (collider == NULL) {
+        return;
+    }
+
+    switch (collider->shape) {
+        case COLSHAPE_JNTSPH: {
+            ColliderJntSph* jntSph = (ColliderJntSph*)collider;
+
+            for (i = 0; i < jntSph->count; i++) {
+                Sphere16* sphere = &jntSph->elements[i].dim.worldSphere;
+
+                CollisionCheck_BoundsAddPoint(bounds, sphere->center.x, sphere->center.y, sphere->center.z,
+                                              ABS(sphere->radius) + COLCHK_BOUNDS_MARGIN);
+            }
+            break;
+        }
+        case COLSHAPE_CYLINDER: {
+            Cylinder16* cyl = &((ColliderCylinder*)collider)->dim;
+            f32 bottom = (f32)cyl->pos.y + cyl->yShift;
+            f32 radius = ABS(cyl->radius) + COLCHK_BOUNDS_MARGIN;
+
+            CollisionCheck_BoundsAddPoint(bounds, cyl->pos.x, bottom, cyl->pos.z, radius);
+            CollisionCheck_BoundsAddPoint(bounds, cyl->pos.x, bottom + cyl->height, cyl->pos.z, radius);
+            break;
+        }
+        case COLSHAPE_TRIS: {
+            ColliderTris* tris = (ColliderTris*)collider;
+
+            for (i = 0; i < tris->count; i++) {
+                for (j = 0; j < 3; j++) {
+                    Vec3f* vtx = &tris->elements[i].dim.vtx[j];
+
+                    CollisionCheck_BoundsAddPoint(bounds, vtx->x, vtx->y, vtx->z, COLCHK_BOUNDS_MARGIN);
+                }
+            }
+            break;
+        }
+        case COLSHAPE_QUAD: {
+            ColliderQuad* quad = (ColliderQuad*)collider;
+
+            for (j = 0; j < 4; j++) {
+                Vec3f* vtx = &quad->dim.quad[j];
+
+                CollisionCheck_BoundsAddPoint(bounds, vtx->x, vtx->y, vtx->z, COLCHK_BOUNDS_MARGIN);
+            }
+            break;
+        }
+    }
+}
+
+static s32 CollisionCheck_BoundsOverlap(ColChkBounds* a, ColChkBounds* b) {
+    return a->min.x <= b->max.x && b->min.x <= a->max.x && a->min.y <= b->max.y && b->min.y <= a->max.y &&
+           a->min.z <= b->max.z && b->min.z <= a->max.z;
+}
+
+static ColChkBroadphase* sBroadphaseSorting;
+
+static int CollisionCheck_CompareBroadphaseMinX(const void* a, const void* b) {
+    s32 indexA = *(const s32*)a;
+    s32 indexB = *(const s32*)b;
+    f32 minXA = sBroadphaseSorting->bounds[indexA].min.x;
+    f32 minXB = sBroadphaseSorting->bounds[indexB].min.x;
+
+    if (minXA != minXB) {
+        return minXA < minXB ? -1 : 1;
+    }
+    return indexA - indexB;
+}
+
+/**
+ * Computes the bounds of the first count colliders in list and sorts them along x.
+ */
+static void CollisionCheck_BuildBroadphase(ColChkBroadphase* broadphase, Collider** list, s32 count) {
+    s32 i;
+
+    if (count > broadphase->capacity) {
+        broadphase->capacity = MAX(count, broadphase->capacity * 2);
+        broadphase->bounds = realloc(broadphase->bounds, broadphase->capacity * sizeof(broadphase->bounds[0]));
+        broadphase->sorted = realloc(broadphase->sorted, broadphase->capacity * sizeof(broadphase->sorted[0]));
+        broadphase->candidates =
+            realloc(broadphase->candidates, broadphase->capacity * sizeof(broadphase->candidates[0]));
+        ASSERT(broadphase->bounds != NULL && broadphase->sorted != NULL && broadphase->candidates != NULL);
+    }
+    broadphase->count = count;
+    for (i = 0; i < count; i++) {
+        CollisionCheck_GetBounds(list[i], &broadphase->bounds[i]);
+        broadphase->sorted[i] = i;
+    }
+    sBroadphaseSorting = broadphase;
+    qsort(broadphase->sorted, count, sizeof(broadphase->sorted[0]), CollisionCheck_CompareBroadphaseMinX);
+}
+
+/**
+ * Writes the list indices of the colliders whose bounds overlap bounds to broadphase->candidates, skipping indices
+ * below minIndex. Candidates are returned in list order so that checks run in the same order as a walk over the whole
+ * list.
+ */
+static s32 CollisionCheck_QueryBroadphase(ColChkBroadphase* broadphase, ColChkBounds* bounds, s32 minIndex) {
+    s32* candidates = broadphase->candidates;
+    s32 numCandidates = 0;
+    s32 i;
+    s32 j;
+
+    for (i = 0; i < broadphase->count; i++) {
+        s32 index = broadphase->sorted[i];
+
+        if (broadphase->bounds[index].min.x > bounds->max.x) {
+            break;
+        }
+        if (index >= minIndex && CollisionCheck_BoundsOverlap(&broadphase->bounds[index], bounds)) {
+            for (j = numCandidates; j > 0 && candidates[j - 1] > index; j--) {
+                candidates[j] = candidates[j - 1];
+            }
+            candidates[j] = index;
+            numCandidates++;
+        }
+    }
+    return numCandidates;
+}
+
+/**
+ * Iterates through the AC colliders whose bounds overlap the AT collider, performing AC collisions with the AT
+ * collider. The AC broadphase must be built for the current AC list.
  */
 void CollisionCheck_AC(PlayState* play, CollisionCheckContext* colChkCtx, Collider* colAT) {
-    Collider** col;
+    ColChkBounds atBounds;
+    s32 numCandidates;
+    s32 i;
 
-    for (col = colChkCtx->colAC; col < colChkCtx->colAC + colChkCtx->colACCount; col++) {
-        Collider* colAC = *col;
+    CollisionCheck_GetBounds(colAT, &atBounds);
+    numCandidates = CollisionCheck_QueryBroadphase(&sACBroadphase, &atBounds, 0);
+
+    for (i = 0; i < numCandidates; i++) {
+        Collider* colAC = colChkCtx->colAC[sACBroadphase.candidates[i]];
 
         if (colAC != NULL && colAC->acFlags & AC_ON) {
             if (colAC->actor != NULL && colAC->actor->update == NULL) {
@@ -2625,6 +2873,7 @@ void CollisionCheck_AT(PlayState* play, CollisionCheckContext* colChkCtx) {
     if (colChkCtx->colATCount == 0 || colChkCtx->colACCount == 0) {
         return;
     }
+    CollisionCheck_BuildBroadphase(&sACBroadphase, colChkCtx->colAC, colChkCtx->colACCount);
     for (col = colChkCtx->colAT; col < colChkCtx->colAT + colChkCtx->colATCount; col++) {
         Collider* colAT = *col;
 
@@ -2887,12 +3136,20 @@ void CollisionCheck_OC(PlayState* play, CollisionCheckContext* colChkCtx) {
     Collider** left;
     Collider** right;
     ColChkVsFunc vsFunc;
+    s32 numCandidates;
+    s32 i;
 
+    CollisionCheck_BuildBroadphase(&sOCBroadphase, colChkCtx->colOC, colChkCtx->colOCCount);
     for (left = colChkCtx->colOC; left < colChkCtx->colOC + colChkCtx->colOCCount; left++) {
         if (*left == NULL || CollisionCheck_SkipOC(*left) == 1) {
             continue;
         }
-        for (right = left + 1; right < colChkCtx->colOC + colChkCtx->colOCCount; right++) {
+        // Only the subsequent colliders whose bounds overlap can collide with this one
+        numCandidates =
+            CollisionCheck_QueryBroadphase(&sOCBroadphase, &sOCBroadphase.bounds[left - colChkCtx->colOC],
+                                           left - colChkCtx->colOC + 1);
+        for (i = 0; i < numCandidates; i++) {
+            right = &colChkCtx->colOC[sOCBroadphase.candidates[i]];
             if (*right == NULL || CollisionCheck_SkipOC(*right) == 1 ||
                 CollisionCheck_Incompatible(*left, *right) == 1) {
                 continue;
@@ -1,10 +1,123 @@
 #include "global.h"
 #include "vt.h"
 
+#include <string.h>
+
 #include "soh/frame_interpolation.h"
 
 EffectSsInfo sEffectSsInfo = { 0 }; // "EffectSS2Info"
 
+// Slot bookkeeping mirroring the table, so that slot searches and the update/draw loops don't have to visit every
+// entry. A slot is in use while its life is not -1, which is what the original free slot search checked. The copies
+// of priority and flag 0 are what the eviction counts were built from, so a slot can be taken out of them again.
+static u32 sEffectSsUsedSlots[(EFFECT_SS_TABLE_SIZE_MAX + 31) / 32];
+static u8 sEffectSsSlotPriority[EFFECT_SS_TABLE_SIZE_MAX];
+static u8 sEffectSsSlotKeep[EFFECT_SS_TABLE_SIZE_MAX];
+static u16 sEffectSsPriorityCount[256];
+static u16 sEffectSsKeepCount[256];
+
+static void EffectSs_ResetSlots(void) {
+    memset(sEffectSsUsedSlots, 0, sizeof(sEffectSsUsedSlots));
+    memset(sEffectSsPriorityCount, 0, sizeof(sEffectSsPriorityCount));
+    memset(sEffectSsKeepCount, 0, sizeof(sEffectSsKeepCount));
+}
+
+/**
+ * Updates the slot bookkeeping after the entry at `index` may have changed. Effects set their own life, priority and
+ * flags from their init, update and draw functions, so this is called after each of those.
+ */
+static void EffectSs_SyncSlot(s32 index) {
+    EffectSs* effectSs = &sEffectSsInfo.table[index];
+    u32* word = &sEffectSsUsedSlots[index / 32];
+    u32 mask = 1u << (index % 32);
+
+    if (*word & mask) {
+        *word &= ~mask;
+        sEffectSsPriorityCount[sEffectSsSlotPriority[index]]--;
+        sEffectSsKeepCount[sEffectSsSlotPriority[index]] -= sEffectSsSlotKeep[index];
+    }
+
+    if (effectSs->life != -1) {
+        *word |= mask;
+        sEffectSsSlotPriority[index] = effectSs->priority;
+        sEffectSsSlotKeep[index] = effectSs->flags & 1;
+        sEffectSsPriorityCount[effectSs->priority]++;
+        sEffectSsKeepCount[effectSs->priority] += sEffectSsSlotKeep[index];
+    }
+}
+
+/**
+ * Rebuilds the slot bookkeeping from the whole table. Needed when the table is overwritten without going through the
+ * effect system, which is what loading a savestate does: the table is on the heap, the bookkeeping is not.
+ */
+void EffectSs_ResyncSlots(void) {
+    s32 i;
+
+    EffectSs_ResetSlots();
+    for (i = 0; i < sEffectSsInfo.tableSize; i++) {
+        EffectSs_SyncSlot(i);
+    }
+}
+
+/**
+ * Returns the first index in [from, to) whose slot is in use (`used` true) or free (`used` false), or -1 if there is
+ * none. Indices are visited in the same order as a linear scan of the table.
+ */
+static s32 EffectSs_ScanSlots(s32 from, s32 to, s32 used) {
+    s32 i = from;
+    u32 bits;
+
+    while (i < to) {
+        bits = sEffectSsUsedSlots[i / 32];
+        if (!used) {
+            bits = ~bits;
+        }
+        bits >>= i % 32;
+
+        if (bits == 0) {
+            // Nothing left in this word
+            i = (i / 32 + 1) * 32;
+            continue;
+        }
+
+        while (!(bits & 1)) {
+            bits >>= 1;
+            i++;
+        }
+        return (i < to) ? i : -1;
+    }
+
+    return -1;
+}
+
+/**
+ * Returns whether some slot in use could be replaced by an effect of the given priority, without scanning the table.
+ */
+static s32 EffectSs_CanEvict(s32 priority) {
+    s32 i;
+
+    if (priority < 0) {
+        return sEffectSsInfo.tableSize != 0;
+    }
+
+    if (priority >= ARRAY_COUNT(sEffectSsPriorityCount)) {
+        return false;
+    }
+
+    // Equal priority only counts when flag 0 is not set
+    if (sEffectSsPriorityCount[priority] != sEffectSsKeepCount[priority]) {
+        return true;
+    }
+
+    for (i = priority + 1; i < ARRAY_COUNT(sEffectSsPriorityCount); i++) {
+        if (sEffectSsPriorityCount[i] != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void EffectSs_InitInfo(PlayState* play, s32 tableSize) {
     u32 i;
     EffectSs* effectSs;
@@ -22,6 +135,7 @@ void EffectSs_InitInfo(PlayState* play, s32 tableSize) {
 
     sEffectSsInfo.searchStartIndex = 0;
     sEffectSsInfo.tableSize = tableSize;
+    EffectSs_ResetSlots();
 
     for (effectSs = &sEffectSsInfo.table[0]; effectSs < &sEffectSsInfo.table[sEffectSsInfo.tableSize]; effectSs++) {
         EffectSs_Reset(effectSs);
@@ -43,6 +157,7 @@ void EffectSs_ClearAll(PlayState* play) {
     sEffectSsInfo.table = NULL;
     sEffectSsInfo.searchStartIndex = 0;
     sEffectSsInfo.tableSize = 0;
+    EffectSs_ResetSlots();
 
     // This code doesn't actually work, since table was just set to NULL and tableSize to 0
     for (effectSs = &sEffectSsInfo.table[0]; effectSs < &sEffectSsInfo.table[sEffectSsInfo.tableSize]; effectSs++) {
@@ -93,44 +208,38 @@ void EffectSs_Reset(EffectSs* effectSs) {
     for (i = 0; i < ARRAY_COUNT(effectSs->regs); i++) {
         effectSs->regs[i] = 0;
     }
+
+    // Effects are also reset outside of the table, e.g. before being passed to EffectSs_Insert
+    if (((uintptr_t)effectSs >= (uintptr_t)&sEffectSsInfo.table[0]) &&
+        ((uintptr_t)effectSs < (uintptr_t)&sEffectSsInfo.table[sEffectSsInfo.tableSize])) {
+        EffectSs_SyncSlot(effectSs - sEffectSsInfo.table);
+    }
 }
 
 s32 EffectSs_FindSlot(s32 priority, s32* pIndex) {
-    s32 foundFree;
     s32 i;
 
     if (sEffectSsInfo.searchStartIndex >= sEffectSsInfo.tableSize) {
         sEffectSsInfo.searchStartIndex = 0;
     }
 
-    // Search for a free slot
-    i = sEffectSsInfo.searchStartIndex;
-    foundFree = false;
-    while (true) {
-        if (sEffectSsInfo.table[i].life == -1) {
-            foundFree = true;
-            break;
-        }
-
-        i++;
-
-        if (i >= sEffectSsInfo.tableSize) {
-            i = 0; // Loop around the whole table
-        }
-
-        // After a full loop, break out
-        if (i == sEffectSsInfo.searchStartIndex) {
-            break;
-        }
+    // Search for a free slot, starting at searchStartIndex and looping around the whole table
+    i = EffectSs_ScanSlots(sEffectSsInfo.searchStartIndex, sEffectSsInfo.tableSize, false);
+    if (i < 0) {
+        i = EffectSs_ScanSlots(0, sEffectSsInfo.searchStartIndex, false);
     }
 
-    if (foundFree == true) {
+    if (i >= 0) {
         *pIndex = i;
         return 0;
     }
 
     // If all slots are in use, search for a slot with a lower priority
     // Note that a lower priority is representend by a higher value
+    if (!EffectSs_CanEvict(priority)) {
+        return 1;
+    }
+
     i = sEffectSsInfo.searchStartIndex;
     while (true) {
         // Equal priority should only be considered "lower" if flag 0 is set
@@ -162,6 +271,7 @@ void EffectSs_Insert(PlayState* play, EffectSs* effectSs) {
         if (EffectSs_FindSlot(effectSs->priority, &index) == 0) {
             sEffectSsInfo.searchStartIndex = index + 1;
             sEffectSsInfo.table[index] = *effectSs;
+            EffectSs_SyncSlot(index);
         }
     }
 }
@@ -246,6 +356,8 @@ void EffectSs_Spawn(PlayState* play, s32 type, s32 priority, void* initParams) {
                      "止します。\n");
         osSyncPrintf(VT_RST);
         EffectSs_Reset(&sEffectSsInfo.table[index]);
+    } else {
+        EffectSs_SyncSlot(index);
     }
 }
 
@@ -262,13 +374,16 @@ void EffectSs_Update(PlayState* play, s32 index) {
         effectSs->pos.z += effectSs->velocity.z;
 
         effectSs->update(play, index, effectSs);
+        EffectSs_SyncSlot(index);
     }
 }
 
 void EffectSs_UpdateAll(PlayState* play) {
     s32 i;
 
-    for (i = 0; i < sEffectSsInfo.tableSize; i++) {
+    // Free slots are skipped. Effects spawned during the loop are still updated this frame if they land after i
+    for (i = EffectSs_ScanSlots(0, sEffectSsInfo.tableSize, true); i >= 0;
+         i = EffectSs_ScanSlots(i + 1, sEffectSsInfo.tableSize, true)) {
         if (sEffectSsInfo.table[i].life > -1) {
             sEffectSsInfo.table[i].life--;
 
@@ -290,6 +405,7 @@ void EffectSs_Draw(PlayState* play, s32 index) {
         FrameInterpolation_RecordOpenChild(effectSs, effectSs->epoch);
         effectSs->draw(play, index, effectSs);
         FrameInterpolation_RecordCloseChild();
+        EffectSs_SyncSlot(index);
     }
 }
 
@@ -301,7 +417,8 @@ void EffectSs_DrawAll(PlayState* play) {
     Lights_BindAll(lights, play->lightCtx.listHead, NULL);
     Lights_Draw(lights, play->state.gfxCtx);
 
-    for (i = 0; i < sEffectSsInfo.tableSize; i++) {
+    for (i = EffectSs_ScanSlots(0, sEffectSsInfo.tableSize, true); i >= 0;
+         i = EffectSs_ScanSlots(i + 1, sEffectSsInfo.tableSize, true)) {
         if (sEffectSsInfo.table[i].life > -1) {
             if ((sEffectSsInfo.table[i].pos.x > 32000.0f) || (sEffectSsInfo.table[i].pos.x < -32000.0f) ||
                 (sEffectSsInfo.table[i].pos.y > 32000.0f) || (sEffectSsInfo.table[i].pos.y < -32000.0f) ||
@@ -2,6 +2,9 @@
 #include "overlays/actors/ovl_En_Elf/z_en_elf.h"
 #include "objects/gameplay_keep/gameplay_keep.h"
 #include "overlays/effects/ovl_Effect_Ss_Dead_Sound/z_eff_ss_dead_sound.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sNewDrops = CVAR_CACHED_INT("gNewDrops", 0);
 
 #define FLAGS 0
 
@@ -552,7 +555,7 @@ void EnItem00_Destroy(Actor* thisx, PlayState* play) {
 
 void func_8001DFC8(EnItem00* this, PlayState* play) {
 
-    if (!CVarGetInteger("gNewDrops", 0)){
+    if (!CVarCache_GetInteger(&sNewDrops)){
         if ((this->actor.params <= ITEM00_RUPEE_RED) || ((this->actor.params == ITEM00_HEART) && (this->unk_15A < 0)) ||
             (this->actor.params == ITEM00_HEART_PIECE)) {
             this->actor.shape.rot.y += 960;
@@ -576,7 +579,7 @@ void func_8001DFC8(EnItem00* this, PlayState* play) {
     }
 
     if (this->actor.params == ITEM00_HEART_PIECE) {
-        if (CVarGetInteger("gNewDrops", 0) && !gSaveContext.n64ddFlag) {
+        if (CVarCache_GetInteger(&sNewDrops) && !gSaveContext.n64ddFlag) {
             this->actor.shape.yOffset = Math_SinS(this->actor.shape.rot.y) * 20.0f + 50.0f;
         } else {
             this->actor.shape.yOffset = Math_SinS(this->actor.shape.rot.y) * 150.0f + 850.0f;
@@ -613,7 +616,7 @@ void func_8001E1C8(EnItem00* this, PlayState* play) {
     f32 originalVelocity;
     Vec3f effectPos;
 
-    if (this->actor.params <= ITEM00_RUPEE_RED && !CVarGetInteger("gNewDrops", 0)) {
+    if (this->actor.params <= ITEM00_RUPEE_RED && !CVarCache_GetInteger(&sNewDrops)) {
         this->actor.shape.rot.y += 960;
     }
 
@@ -715,9 +718,9 @@ void func_8001E5C8(EnItem00* this, PlayState* play) {
 
     this->actor.world.pos = player->actor.world.pos;
 
-    if (this->actor.params <= ITEM00_RUPEE_RED && !CVarGetInteger("gNewDrops", 0)) {
+    if (this->actor.params <= ITEM00_RUPEE_RED && !CVarCache_GetInteger(&sNewDrops)) {
         this->actor.shape.rot.y += 960;
-    } else if (this->actor.params == ITEM00_HEART && !CVarGetInteger("gNewDrops", 0)) {
+    } else if (this->actor.params == ITEM00_HEART && !CVarCache_GetInteger(&sNewDrops)) {
         this->actor.shape.rot.y = 0;
     }
 
@@ -742,7 +745,7 @@ void EnItem00_Update(Actor* thisx, PlayState* play) {
     s32 pad;
 
 	// OTRTODO: remove special case for bombchu when its 2D drop is implemented
-    if (CVarGetInteger("gNewDrops", 0) || this->actor.params == ITEM00_BOMBCHU) { //set the rotation system on selected model only :)
+    if (CVarCache_GetInteger(&sNewDrops) || this->actor.params == ITEM00_BOMBCHU) { //set the rotation system on selected model only :)
         if ((this->actor.params == ITEM00_RUPEE_GREEN) || (this->actor.params == ITEM00_RUPEE_BLUE) ||
             (this->actor.params == ITEM00_RUPEE_RED) || (this->actor.params == ITEM00_ARROWS_SINGLE) || 
             (this->actor.params == ITEM00_ARROWS_SMALL) || (this->actor.params == ITEM00_ARROWS_MEDIUM) ||
@@ -977,7 +980,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
     if (!(this->unk_156 & this->unk_158)) {
         switch (this->actor.params) {
             case ITEM00_RUPEE_GREEN:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.3f);
                     this->scale = 0.3f;
                     this->actor.shape.yOffset = 50.0f;
@@ -987,7 +990,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }    
             case ITEM00_RUPEE_BLUE:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.3f);
                     this->scale = 0.3f;
                     this->actor.shape.yOffset = 50.0f;
@@ -997,7 +1000,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_RUPEE_RED:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.3f);
                     this->scale = 0.3f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1014,7 +1017,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_RUPEE_ORANGE:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.45f);
                     this->scale = 0.45f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1031,7 +1034,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_RUPEE_PURPLE:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.4f);
                     this->scale = 0.4f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1048,7 +1051,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_HEART_PIECE:
-                if (CVarGetInteger("gNewDrops", 0) && !gSaveContext.n64ddFlag) {
+                if (CVarCache_GetInteger(&sNewDrops) && !gSaveContext.n64ddFlag) {
                     Actor_SetScale(&this->actor, 0.5f);
                     this->scale = 0.5f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1067,7 +1070,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                 EnItem00_DrawHeartContainer(this, play);
                 break;
             case ITEM00_HEART:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     this->actor.home.rot.z = Rand_CenteredFloat(65535.0f);
                     this->actor.shape.yOffset = 25.0f;
                     this->actor.shape.shadowScale = 0.3f;
@@ -1104,7 +1107,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                 }
                 
             case ITEM00_BOMBS_A:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.2f);
                     this->scale = 0.2f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1114,7 +1117,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_BOMBS_B:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.2f);
                     this->scale = 0.2f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1125,7 +1128,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                 }
             case ITEM00_BOMBS_SPECIAL:
             case ITEM00_ARROWS_SINGLE:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.2f);
                     this->scale = 0.2f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1135,7 +1138,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_ARROWS_SMALL:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.2f);
                     this->scale = 0.2f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1145,7 +1148,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_ARROWS_MEDIUM:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.2f);
                     this->scale = 0.2f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1155,7 +1158,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_ARROWS_LARGE:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.2f);
                     this->scale = 0.2f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1165,7 +1168,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_NUTS:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.2f);
                     this->scale = 0.2f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1175,7 +1178,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_STICK:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.2f);
                     this->scale = 0.2f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1185,7 +1188,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_MAGIC_LARGE:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.2f);
                     this->scale = 0.2f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1195,7 +1198,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_MAGIC_SMALL:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.2f);
                     this->scale = 0.2f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1205,7 +1208,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_SEEDS:
-                if (CVarGetInteger("gNewDrops", 0)) {
+                if (CVarCache_GetInteger(&sNewDrops)) {
                     Actor_SetScale(&this->actor, 0.2f);
                     this->scale = 0.2f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1215,7 +1218,7 @@ void EnItem00_Draw(Actor* thisx, PlayState* play) {
                     break;
                 }
             case ITEM00_SMALL_KEY:
-                if (CVarGetInteger("gNewDrops", 0) && !gSaveContext.n64ddFlag) {
+                if (CVarCache_GetInteger(&sNewDrops) && !gSaveContext.n64ddFlag) {
                     Actor_SetScale(&this->actor, 0.2f);
                     this->scale = 0.2f;
                     this->actor.shape.yOffset = 50.0f;
@@ -1,15 +1,242 @@
 #include "global.h"
+#include "vt.h"
 #include <string.h>
 
 #define LOG_SEVERITY_NOLOG 0
 #define LOG_SEVERITY_ERROR 2
 #define LOG_SEVERITY_VERBOSE 3
 
+// Size-class pool. When enabled, part of the arena is set aside at init and split into pages, and each page hands out
+// blocks of a single size class. Small allocations such as actor instances come from there in constant time instead
+// of walking the arena's free list, and can't fragment the rest of the arena. Anything larger than the biggest class,
+// or that doesn't fit in the pool, falls back to the arena.
+// All of the pool's state, including the free lists and counters, is allocated from the arena itself, so savestates
+// capture it along with the blocks it describes. sZeldaArenaPool only points at it.
+#define ZELDA_ARENA_POOL_PAGE_SIZE 0x4000
+#define ZELDA_ARENA_POOL_FRACTION 8 // the pool takes up 1/8 of the arena
+#define ZELDA_ARENA_POOL_NULL -1
+
+typedef struct ZeldaArenaPoolBlock {
+    struct ZeldaArenaPoolBlock* next;
+} ZeldaArenaPoolBlock;
+
+typedef struct {
+    ZeldaArenaPoolBlock* freeList;
+    s16 sizeClass; // ZELDA_ARENA_POOL_NULL while the page is unused
+    s16 prev;      // neighbours in the class's list of pages with free blocks
+    s16 next;
+    u16 numUsed;
+} ZeldaArenaPoolPage;
+
+static const u16 sZeldaArenaSizeClasses[] = {
+    0x20, 0x40, 0x80, 0xC0, 0x100, 0x180, 0x200, 0x300, 0x400, 0x600, 0x800,
+};
+
+typedef struct ZeldaArenaPool {
+    u8* start;
+    u8* end;
+    s32 numPages;
+    s16 freePage; // first unused page, unused pages are chained through next
+    s16 partialPages[ARRAY_COUNT(sZeldaArenaSizeClasses)];
+    u32 pagesUsed;
+    u32 blocksUsed;
+    u32 bytesUsed;
+    ZeldaArenaPoolPage pages[]; // numPages entries
+} ZeldaArenaPool;
+
 s32 gZeldaArenaLogSeverity = LOG_SEVERITY_ERROR;
 Arena sZeldaArena;
+ZeldaArenaPool* sZeldaArenaPool; // NULL while the pool is disabled
+static ZeldaArenaStats sZeldaArenaCounters;
+
+static void ZeldaArena_PoolInit(size_t arenaSize) {
+    ZeldaArenaPool* pool;
+    u8* start;
+    s32 numPages = arenaSize / ZELDA_ARENA_POOL_FRACTION / ZELDA_ARENA_POOL_PAGE_SIZE;
+    s32 i;
+
+    sZeldaArenaPool = NULL;
+    if (numPages <= 0) {
+        return;
+    }
+    numPages = CLAMP_MAX(numPages, 0x7FFF);
+
+    pool = __osMalloc(&sZeldaArena, sizeof(ZeldaArenaPool) + numPages * sizeof(ZeldaArenaPoolPage));
+    start = __osMalloc(&sZeldaArena, numPages * ZELDA_ARENA_POOL_PAGE_SIZE);
+    if (pool == NULL || start == NULL) {
+        __osFree(&sZeldaArena, pool);
+        __osFree(&sZeldaArena, start);
+        return;
+    }
+
+    pool->start = start;
+    pool->end = pool->start + numPages * ZELDA_ARENA_POOL_PAGE_SIZE;
+    pool->numPages = numPages;
+    for (i = 0; i < numPages; i++) {
+        pool->pages[i].freeList = NULL;
+        pool->pages[i].sizeClass = ZELDA_ARENA_POOL_NULL;
+        pool->pages[i].prev = ZELDA_ARENA_POOL_NULL;
+        pool->pages[i].next = (i + 1 < numPages) ? i + 1 : ZELDA_ARENA_POOL_NULL;
+        pool->pages[i].numUsed = 0;
+    }
+    pool->freePage = 0;
+    for (i = 0; i < ARRAY_COUNT(pool->partialPages); i++) {
+        pool->partialPages[i] = ZELDA_ARENA_POOL_NULL;
+    }
+    pool->pagesUsed = 0;
+    pool->blocksUsed = 0;
+    pool->bytesUsed = 0;
+    sZeldaArenaPool = pool;
+}
+
+static void ZeldaArena_PoolUnlinkPage(ZeldaArenaPool* pool, s32 sizeClass, s32 pageIdx) {
+    ZeldaArenaPoolPage* page = &pool->pages[pageIdx];
+
+    if (page->prev != ZELDA_ARENA_POOL_NULL) {
+        pool->pages[page->prev].next = page->next;
+    } else {
+        pool->partialPages[sizeClass] = page->next;
+    }
+    if (page->next != ZELDA_ARENA_POOL_NULL) {
+        pool->pages[page->next].prev = page->prev;
+    }
+    page->prev = page->next = ZELDA_ARENA_POOL_NULL;
+}
+
+static void ZeldaArena_PoolLinkPage(ZeldaArenaPool* pool, s32 sizeClass, s32 pageIdx) {
+    ZeldaArenaPoolPage* page = &pool->pages[pageIdx];
+
+    page->prev = ZELDA_ARENA_POOL_NULL;
+    page->next = pool->partialPages[sizeClass];
+    if (page->next != ZELDA_ARENA_POOL_NULL) {
+        pool->pages[page->next].prev = pageIdx;
+    }
+    pool->partialPages[sizeClass] = pageIdx;
+}
+
+/**
+ * Returns a block of at least `size` bytes from the pool, or NULL if `size` has no size class or the pool is full.
+ */
+static void* ZeldaArena_PoolMalloc(size_t size) {
+    ZeldaArenaPool* pool = sZeldaArenaPool;
+    ZeldaArenaPoolPage* page;
+    ZeldaArenaPoolBlock* block;
+    s32 sizeClass;
+    s32 pageIdx;
+
+    if (pool == NULL || size == 0) {
+        return NULL;
+    }
+    for (sizeClass = 0; sizeClass < ARRAY_COUNT(sZeldaArenaSizeClasses); sizeClass++) {
+        if (size <= sZeldaArenaSizeClasses[sizeClass]) {
+            break;
+        }
+    }
+    if (sizeClass == ARRAY_COUNT(sZeldaArenaSizeClasses)) {
+        return NULL;
+    }
+
+    ArenaImpl_Lock(&sZeldaArena);
+    pageIdx = pool->partialPages[sizeClass];
+    if (pageIdx == ZELDA_ARENA_POOL_NULL) {
+        u16 blockSize = sZeldaArenaSizeClasses[sizeClass];
+        u8* pageStart;
+        s32 i;
+
+        // Take an unused page and split it into blocks of this class
+        pageIdx = pool->freePage;
+        if (pageIdx == ZELDA_ARENA_POOL_NULL) {
+            ArenaImpl_Unlock(&sZeldaArena);
+            return NULL;
+        }
+        page = &pool->pages[pageIdx];
+        pool->freePage = page->next;
+        page->sizeClass = sizeClass;
+        page->freeList = NULL;
+        pageStart = pool->start + pageIdx * ZELDA_ARENA_POOL_PAGE_SIZE;
+        for (i = ZELDA_ARENA_POOL_PAGE_SIZE / blockSize - 1; i >= 0; i--) {
+            block = (ZeldaArenaPoolBlock*)(pageStart + i * blockSize);
+            block->next = page->freeList;
+            page->freeList = block;
+        }
+        ZeldaArena_PoolLinkPage(pool, sizeClass, pageIdx);
+        pool->pagesUsed++;
+    }
+
+    page = &pool->pages[pageIdx];
+    block = page->freeList;
+    page->freeList = block->next;
+    page->numUsed++;
+    if (page->freeList == NULL) {
+        ZeldaArena_PoolUnlinkPage(pool, sizeClass, pageIdx);
+    }
+    pool->blocksUsed++;
+    pool->bytesUsed += sZeldaArenaSizeClasses[sizeClass];
+    ArenaImpl_Unlock(&sZeldaArena);
+
+    return block;
+}
+
+static s32 ZeldaArena_PoolContains(void* ptr) {
+    return sZeldaArenaPool != NULL && (u8*)ptr >= sZeldaArenaPool->start && (u8*)ptr < sZeldaArenaPool->end;
+}
+
+/**
+ * Returns the usable size of a block allocated from the pool.
+ */
+static size_t ZeldaArena_PoolGetSize(void* ptr) {
+    s32 pageIdx = ((u8*)ptr - sZeldaArenaPool->start) / ZELDA_ARENA_POOL_PAGE_SIZE;
+
+    return sZeldaArenaSizeClasses[sZeldaArenaPool->pages[pageIdx].sizeClass];
+}
+
+static void ZeldaArena_PoolFree(void* ptr) {
+    ZeldaArenaPool* pool = sZeldaArenaPool;
+    s32 pageIdx = ((u8*)ptr - pool->start) / ZELDA_ARENA_POOL_PAGE_SIZE;
+    ZeldaArenaPoolPage* page = &pool->pages[pageIdx];
+    ZeldaArenaPoolBlock* block = ptr;
+    s32 sizeClass = page->sizeClass;
+
+    if (sizeClass == ZELDA_ARENA_POOL_NULL || page->numUsed == 0 ||
+        ((u8*)ptr - (pool->start + pageIdx * ZELDA_ARENA_POOL_PAGE_SIZE)) % sZeldaArenaSizeClasses[sizeClass] != 0) {
+        osSyncPrintf(VT_COL(RED, WHITE) "ZeldaArena_PoolFree: invalid free (%p)\n" VT_RST, ptr);
+        return;
+    }
+
+    ArenaImpl_Lock(&sZeldaArena);
+    if (page->freeList == NULL) {
+        ZeldaArena_PoolLinkPage(pool, sizeClass, pageIdx);
+    }
+    block->next = page->freeList;
+    page->freeList = block;
+    page->numUsed--;
+    pool->blocksUsed--;
+    pool->bytesUsed -= sZeldaArenaSizeClasses[sizeClass];
+
+    if (page->numUsed == 0) {
+        // Return the page so that any size class can use it
+        ZeldaArena_PoolUnlinkPage(pool, sizeClass, pageIdx);
+        page->sizeClass = ZELDA_ARENA_POOL_NULL;
+        page->freeList = NULL;
+        page->next = pool->freePage;
+        pool->freePage = pageIdx;
+        pool->pagesUsed--;
+    }
+    ArenaImpl_Unlock(&sZeldaArena);
+}
 
 void ZeldaArena_CheckPointer(void* ptr, size_t size, const char* name, const char* action) {
     if (ptr == NULL) {
+        u32 maxFree;
+        u32 free;
+        u32 alloc;
+
+        // Keep enough to tell fragmentation apart from running out of memory
+        ArenaImpl_GetSizes(&sZeldaArena, &maxFree, &free, &alloc);
+        sZeldaArenaCounters.failedAllocs++;
+        sZeldaArenaCounters.lastFailedSize = size;
+        sZeldaArenaCounters.lastFailedLargestFree = maxFree;
+
         if (gZeldaArenaLogSeverity >= LOG_SEVERITY_ERROR) {
             // "%s: %u bytes %s failed\n"
             osSyncPrintf("%s: %u バイトの%sに失敗しました\n", name, size, action);
@@ -22,14 +249,28 @@ void ZeldaArena_CheckPointer(void* ptr, size_t size, const char* name, const cha
 }
 
 void* ZeldaArena_Malloc(size_t size) {
-    void* ptr = __osMalloc(&sZeldaArena, size);
+    void* ptr = ZeldaArena_PoolMalloc(size);
+
+    if (ptr != NULL) {
+        sZeldaArenaCounters.poolAllocs++;
+    } else {
+        ptr = __osMalloc(&sZeldaArena, size);
+        sZeldaArenaCounters.arenaAllocs++;
+    }
 
     ZeldaArena_CheckPointer(ptr, size, "zelda_malloc", "確保"); // "Secure"
     return ptr;
 }
 
 void* ZeldaArena_MallocDebug(size_t size, const char* file, s32 line) {
-    void* ptr = __osMallocDebug(&sZeldaArena, size, file, line);
+    void* ptr = ZeldaArena_PoolMalloc(size);
+
+    if (ptr != NULL) {
+        sZeldaArenaCounters.poolAllocs++;
+    } else {
+        ptr = __osMallocDebug(&sZeldaArena, size, file, line);
+        sZeldaArenaCounters.arenaAllocs++;
+    }
 
     ZeldaArena_CheckPointer(ptr, size, "zelda_malloc_DEBUG", "確保"); // "Secure"
     return ptr;
@@ -38,6 +279,8 @@ void* ZeldaArena_MallocDebug(size_t size, const char* file, s32 line) {
 void* ZeldaArena_MallocR(size_t size) {
     void* ptr = __osMallocR(&sZeldaArena, size);
 
+    sZeldaArenaCounters.arenaAllocs++;
+
     ZeldaArena_CheckPointer(ptr, size, "zelda_malloc_r", "確保"); // "Secure"
     return ptr;
 }
@@ -45,27 +288,67 @@ void* ZeldaArena_MallocR(size_t size) {
 void* ZeldaArena_MallocRDebug(size_t size, const char* file, s32 line) {
     void* ptr = __osMallocRDebug(&sZeldaArena, size, file, line);
 
+    sZeldaArenaCounters.arenaAllocs++;
+
     ZeldaArena_CheckPointer(ptr, size, "zelda_malloc_r_DEBUG", "確保"); // "Secure"
     return ptr;
 }
 
+/**
+ * Moves a pool block to a new allocation of `newSize` bytes, or keeps it if it is already large enough.
+ */
+static void* ZeldaArena_PoolRealloc(void* ptr, size_t newSize) {
+    size_t oldSize = ZeldaArena_PoolGetSize(ptr);
+    void* newPtr;
+
+    if (newSize == 0) {
+        ZeldaArena_PoolFree(ptr);
+        return NULL;
+    }
+    if (newSize <= oldSize) {
+        return ptr;
+    }
+    newPtr = ZeldaArena_Malloc(newSize);
+    if (newPtr != NULL) {
+        memcpy(newPtr, ptr, oldSize);
+        ZeldaArena_PoolFree(ptr);
+    }
+    return newPtr;
+}
+
 void* ZeldaArena_Realloc(void* ptr, size_t newSize) {
-    ptr = __osRealloc(&sZeldaArena, ptr, newSize);
+    if (ZeldaArena_PoolContains(ptr)) {
+        ptr = ZeldaArena_PoolRealloc(ptr, newSize);
+    } else {
+        ptr = __osRealloc(&sZeldaArena, ptr, newSize);
+    }
     ZeldaArena_CheckPointer(ptr, newSize, "zelda_realloc", "再確保"); // "Re-securing"
     return ptr;
 }
 
 void* ZeldaArena_ReallocDebug(void* ptr, size_t newSize, const char* file, s32 line) {
-    ptr = __osReallocDebug(&sZeldaArena, ptr, newSize, file, line);
+    if (ZeldaArena_PoolContains(ptr)) {
+        ptr = ZeldaArena_PoolRealloc(ptr, newSize);
+    } else {
+        ptr = __osReallocDebug(&sZeldaArena, ptr, newSize, file, line);
+    }
     ZeldaArena_CheckPointer(ptr, newSize, "zelda_realloc_DEBUG", "再確保"); // "Re-securing"
     return ptr;
 }
 
 void ZeldaArena_Free(void* ptr) {
+    if (ZeldaArena_PoolContains(ptr)) {
+        ZeldaArena_PoolFree(ptr);
+        return;
+    }
     __osFree(&sZeldaArena, ptr);
 }
 
 void ZeldaArena_FreeDebug(void* ptr, const char* file, s32 line) {
+    if (ZeldaArena_PoolContains(ptr)) {
+        ZeldaArena_PoolFree(ptr);
+        return;
+    }
     __osFreeDebug(&sZeldaArena, ptr, file, line);
 }
 
@@ -73,7 +356,13 @@ void* ZeldaArena_Calloc(size_t num, size_t size) {
     void* ret;
     size_t n = num * size;
 
-    ret = __osMalloc(&sZeldaArena, n);
+    ret = ZeldaArena_PoolMalloc(n);
+    if (ret != NULL) {
+        sZeldaArenaCounters.poolAllocs++;
+    } else {
+        ret = __osMalloc(&sZeldaArena, n);
+        sZeldaArenaCounters.arenaAllocs++;
+    }
     if (ret != NULL) {
         memset(ret, 0,n);
     }
@@ -91,6 +380,43 @@ void ZeldaArena_GetSizes(u32* outMaxFree, u32* outFree, u32* outAlloc) {
     ArenaImpl_GetSizes(&sZeldaArena, outMaxFree, outFree, outAlloc);
 }
 
+/**
+ * Fills `stats` with the current state of the arena and the size-class pool. Walks the whole arena, so this is meant
+ * for debugging tools rather than per-frame use.
+ */
+void ZeldaArena_GetStats(ZeldaArenaStats* stats) {
+    ArenaNode* iter;
+
+    *stats = sZeldaArenaCounters;
+    stats->freeBlocks = 0;
+    stats->largestFree = 0;
+    stats->totalFree = 0;
+    stats->totalAlloc = 0;
+
+    if (__osMallocIsInitalized(&sZeldaArena)) {
+        ArenaImpl_Lock(&sZeldaArena);
+        for (iter = sZeldaArena.head; iter != NULL; iter = ArenaImpl_GetNextBlock(iter)) {
+            if (iter->isFree) {
+                stats->freeBlocks++;
+                stats->totalFree += iter->size;
+                stats->largestFree = CLAMP_MIN(stats->largestFree, iter->size);
+            } else {
+                stats->totalAlloc += iter->size;
+            }
+        }
+        ArenaImpl_Unlock(&sZeldaArena);
+    }
+    stats->fragmentation = (stats->totalFree != 0) ? 1.0f - (f32)stats->largestFree / stats->totalFree : 0.0f;
+
+    stats->poolEnabled = sZeldaArenaPool != NULL;
+    if (sZeldaArenaPool != NULL) {
+        stats->poolPages = sZeldaArenaPool->numPages;
+        stats->poolPagesUsed = sZeldaArenaPool->pagesUsed;
+        stats->poolBlocksUsed = sZeldaArenaPool->blocksUsed;
+        stats->poolBytesUsed = sZeldaArenaPool->bytesUsed;
+    }
+}
+
 void ZeldaArena_Check() {
     __osCheckArena(&sZeldaArena);
 }
@@ -98,11 +424,17 @@ void ZeldaArena_Check() {
 void ZeldaArena_Init(void* start, size_t size) {
     gZeldaArenaLogSeverity = LOG_SEVERITY_NOLOG;
     __osMallocInit(&sZeldaArena, start, size);
+    memset(&sZeldaArenaCounters, 0, sizeof(sZeldaArenaCounters));
+    sZeldaArenaPool = NULL;
+    if (CVarGetInteger("gZeldaArenaSizeClasses", 0)) {
+        ZeldaArena_PoolInit(size);
+    }
 }
 
 void ZeldaArena_Cleanup() {
     gZeldaArenaLogSeverity = LOG_SEVERITY_NOLOG;
     __osMallocCleanup(&sZeldaArena);
+    sZeldaArenaPool = NULL;
 }
 
 u8 ZeldaArena_IsInitalized() {
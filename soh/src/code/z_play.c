@@ -468,7 +468,8 @@ void Play_Init(GameState* thisx) {
     GameOver_Init(play);
     SoundSource_InitAll(play);
     Effect_InitContext(play);
-    EffectSs_InitInfo(play, 0x55);
+    EffectSs_InitInfo(play, CLAMP(CVarGetInteger("gEffectSsTableSize", EFFECT_SS_TABLE_SIZE), EFFECT_SS_TABLE_SIZE,
+                                  EFFECT_SS_TABLE_SIZE_MAX));
     CollisionCheck_InitContext(play, &play->colChkCtx);
     AnimationContext_Reset(&play->animationCtx);
     func_8006450C(play, &play->csCtx);
@@ -7,6 +7,9 @@
 #include "z_bg_haka_gate.h"
 #include "objects/gameplay_keep/gameplay_keep.h"
 #include "objects/object_haka_objects/object_haka_objects.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sFasterBlockPush = CVAR_CACHED_INT("gFasterBlockPush", 0);
 
 #define FLAGS 0
 
@@ -211,9 +214,9 @@ void BgHakaGate_StatueTurn(BgHakaGate* this, PlayState* play) {
     if (turnFinished) {
         player->stateFlags2 &= ~0x10;
         this->vRotYDeg10 = (this->vRotYDeg10 + turnAngle) % 3600;
-        this->vTurnRateDeg10 = CVarGetInteger("gFasterBlockPush", 0) * 2;
+        this->vTurnRateDeg10 = CVarCache_GetInteger(&sFasterBlockPush) * 2;
         this->vTurnAngleDeg10 = 0;
-        this->vTimer = 5 - ((CVarGetInteger("gFasterBlockPush", 0) * 3) / 5);
+        this->vTimer = 5 - ((CVarCache_GetInteger(&sFasterBlockPush) * 3) / 5);
         this->actionFunc = BgHakaGate_StatueIdle;
         this->dyna.unk_150 = 0.0f;
     }
@@ -6,6 +6,9 @@
 
 #include "z_bg_hidan_rock.h"
 #include "objects/object_hidan_objects/object_hidan_objects.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sFasterBlockPush = CVAR_CACHED_INT("gFasterBlockPush", 0);
 
 #define FLAGS 0
 
@@ -137,9 +140,9 @@ void func_8088B268(BgHidanRock* this, PlayState* play) {
                 }
             }
 
-            this->dyna.actor.speedXZ = this->dyna.actor.speedXZ + (CVarGetInteger("gFasterBlockPush", 0) * 0.3) + 0.5f;
+            this->dyna.actor.speedXZ = this->dyna.actor.speedXZ + (CVarCache_GetInteger(&sFasterBlockPush) * 0.3) + 0.5f;
             this->dyna.actor.speedXZ =
-                CLAMP_MAX(this->dyna.actor.speedXZ, 2.0f + (CVarGetInteger("gFasterBlockPush", 0) * 0.5));
+                CLAMP_MAX(this->dyna.actor.speedXZ, 2.0f + (CVarCache_GetInteger(&sFasterBlockPush) * 0.5));
 
             if (D_8088BFC0 > 0.0f) {
                 temp_v1 = Math_StepToF(&D_8088BFC0, 20.0f, this->dyna.actor.speedXZ);
@@ -157,7 +160,7 @@ void func_8088B268(BgHidanRock* this, PlayState* play) {
                 this->dyna.actor.home.pos.z = this->dyna.actor.world.pos.z;
                 D_8088BFC0 = 0.0f;
                 this->dyna.actor.speedXZ = 0.0f;
-                this->timer = 5 - ((CVarGetInteger("gFasterBlockPush", 0) * 3) / 5);
+                this->timer = 5 - ((CVarCache_GetInteger(&sFasterBlockPush) * 3) / 5);
             }
 
             func_8002F974(&this->dyna.actor, NA_SE_EV_ROCK_SLIDE - SFX_FLAG);
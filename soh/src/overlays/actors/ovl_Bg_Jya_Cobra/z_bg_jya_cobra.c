@@ -6,6 +6,9 @@
 #include "overlays/actors/ovl_Mir_Ray/z_mir_ray.h"
 #include "objects/object_jya_obj/object_jya_obj.h"
 #include "vt.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sFasterBlockPush = CVAR_CACHED_INT("gFasterBlockPush", 0);
 
 #define FLAGS ACTOR_FLAG_4
 
@@ -443,7 +446,7 @@ void func_80896950(BgJyaCobra* this, PlayState* play) {
 
     if (this->dyna.unk_150 > 0.001f) {
         this->unk_168++;
-        if (this->unk_168 >= (15 - CVarGetInteger("gFasterBlockPush", 0) * 2)) {
+        if (this->unk_168 >= (15 - CVarCache_GetInteger(&sFasterBlockPush) * 2)) {
             func_808969F8(this, play);
         }
     } else {
@@ -478,7 +481,7 @@ void func_808969F8(BgJyaCobra* this, PlayState* play) {
     this->unk_174.z = player->actor.world.pos.z - this->dyna.actor.world.pos.z;
     this->unk_170 = 0;
     this->unk_172 = true;
-    this->unk_16E = CVarGetInteger("gFasterBlockPush", 0) * 20;
+    this->unk_16E = CVarCache_GetInteger(&sFasterBlockPush) * 20;
 }
 
 void func_80896ABC(BgJyaCobra* this, PlayState* play) {
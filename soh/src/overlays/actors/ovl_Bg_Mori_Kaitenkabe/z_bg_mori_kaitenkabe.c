@@ -6,6 +6,9 @@
 
 #include "z_bg_mori_kaitenkabe.h"
 #include "objects/object_mori_objects/object_mori_objects.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sFasterBlockPush = CVAR_CACHED_INT("gFasterBlockPush", 0);
 
 #define FLAGS 0
 
@@ -94,7 +97,7 @@ void BgMoriKaitenkabe_Wait(BgMoriKaitenkabe* this, PlayState* play) {
 
     if (this->dyna.unk_150 > 0.001f) {
         this->timer++;
-        if ((this->timer > (28 - CVarGetInteger("gFasterBlockPush", 0) * 4)) && !Player_InCsMode(play)) {
+        if ((this->timer > (28 - CVarCache_GetInteger(&sFasterBlockPush) * 4)) && !Player_InCsMode(play)) {
             BgMoriKaitenkabe_SetupRotate(this);
             func_8002DF54(play, &this->dyna.actor, 8);
             Math_Vec3f_Copy(&this->lockedPlayerPos, &player->actor.world.pos);
@@ -118,7 +121,7 @@ void BgMoriKaitenkabe_Wait(BgMoriKaitenkabe* this, PlayState* play) {
 
 void BgMoriKaitenkabe_SetupRotate(BgMoriKaitenkabe* this) {
     this->actionFunc = BgMoriKaitenkabe_Rotate;
-    this->rotSpeed = CVarGetInteger("gFasterBlockPush", 0) * 0.1f;
+    this->rotSpeed = CVarCache_GetInteger(&sFasterBlockPush) * 0.1f;
     this->rotYdeg = 0.0f;
 }
 
@@ -6,6 +6,9 @@
 
 #include "z_bg_po_event.h"
 #include "objects/object_po_sisters/object_po_sisters.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sFasterBlockPush = CVAR_CACHED_INT("gFasterBlockPush", 0);
 
 #define FLAGS 0
 
@@ -387,8 +390,8 @@ void BgPoEvent_BlockPush(BgPoEvent* this, PlayState* play) {
     s32 blockStop;
     Player* player = GET_PLAYER(play);
 
-    this->dyna.actor.speedXZ = this->dyna.actor.speedXZ + (CVarGetInteger("gFasterBlockPush", 0) * 0.3) + 0.5f;
-    this->dyna.actor.speedXZ = CLAMP_MAX(this->dyna.actor.speedXZ, 2.0f + (CVarGetInteger("gFasterBlockPush", 0) * 0.5));
+    this->dyna.actor.speedXZ = this->dyna.actor.speedXZ + (CVarCache_GetInteger(&sFasterBlockPush) * 0.3) + 0.5f;
+    this->dyna.actor.speedXZ = CLAMP_MAX(this->dyna.actor.speedXZ, 2.0f + (CVarCache_GetInteger(&sFasterBlockPush) * 0.5));
     blockStop = Math_StepToF(&sBgPoEventblockPushDist, 20.0f, this->dyna.actor.speedXZ);
     displacement = this->direction * sBgPoEventblockPushDist;
     this->dyna.actor.world.pos.x = (Math_SinS(this->dyna.unk_158) * displacement) + this->dyna.actor.home.pos.x;
@@ -403,7 +406,7 @@ void BgPoEvent_BlockPush(BgPoEvent* this, PlayState* play) {
         this->dyna.actor.home.pos.z = this->dyna.actor.world.pos.z;
         sBgPoEventblockPushDist = 0.0f;
         this->dyna.actor.speedXZ = 0.0f;
-        this->direction = 5 - ((CVarGetInteger("gFasterBlockPush", 0) * 3) / 5);
+        this->direction = 5 - ((CVarCache_GetInteger(&sFasterBlockPush) * 3) / 5);
         sBgPoEventBlocksAtRest++;
         this->actionFunc = BgPoEvent_BlockIdle;
         if (this->type == 1) {
@@ -6,6 +6,9 @@
 
 #include "z_bg_spot15_rrbox.h"
 #include "objects/object_spot15_obj/object_spot15_obj.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sFasterBlockPush = CVAR_CACHED_INT("gFasterBlockPush", 0);
 
 #define FLAGS 0
 
@@ -260,9 +263,9 @@ void func_808B4194(BgSpot15Rrbox* this, PlayState* play) {
     s32 approxFResult;
     Actor* actor = &this->dyna.actor;
 
-    this->unk_174 = this->unk_174 + ((CVarGetInteger("gFasterBlockPush", 0) / 2) * 0.5) + 0.5f;
+    this->unk_174 = this->unk_174 + ((CVarCache_GetInteger(&sFasterBlockPush) / 2) * 0.5) + 0.5f;
 
-    this->unk_174 = CLAMP_MAX(this->unk_174, 2.0f + (CVarGetInteger("gFasterBlockPush", 0) * 0.5));
+    this->unk_174 = CLAMP_MAX(this->unk_174, 2.0f + (CVarCache_GetInteger(&sFasterBlockPush) * 0.5));
 
     approxFResult = Math_StepToF(&this->unk_178, 20.0f, this->unk_174);
 
@@ -294,7 +297,7 @@ void func_808B4194(BgSpot15Rrbox* this, PlayState* play) {
         this->dyna.unk_150 = 0.0f;
         this->unk_178 = 0.0f;
         this->unk_174 = 0.0f;
-        this->unk_168 = 10 - ((CVarGetInteger("gFasterBlockPush", 0) * 3) / 2);
+        this->unk_168 = 10 - ((CVarCache_GetInteger(&sFasterBlockPush) * 3) / 2);
         func_808B4084(this, play);
     }
     Audio_PlayActorSound2(actor, NA_SE_EV_ROCK_SLIDE - SFX_FLAG);
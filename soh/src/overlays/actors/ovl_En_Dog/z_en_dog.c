@@ -6,6 +6,9 @@
 
 #include "z_en_dog.h"
 #include "objects/object_dog/object_dog.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sDogFollowsEverywhere = CVAR_CACHED_INT("gDogFollowsEverywhere", 0);
 
 #define FLAGS 0
 
@@ -371,7 +374,7 @@ void EnDog_FollowPlayer(EnDog* this, PlayState* play) {
         return;
     }
 
-    if (CVarGetInteger("gDogFollowsEverywhere", 0)) {
+    if (CVarCache_GetInteger(&sDogFollowsEverywhere)) {
         // If the dog is too far away it's usually because they are stuck in a hole or on a different floor, this gives them a push
         if (this->actor.xyzDistToPlayerSq > 250000.0f) {
             Player* player = GET_PLAYER(play);
@@ -392,7 +395,7 @@ void EnDog_FollowPlayer(EnDog* this, PlayState* play) {
     }
 
     if (this->actor.xzDistToPlayer > 400.0f) {
-        if (CVarGetInteger("gDogFollowsEverywhere", 0)) {
+        if (CVarCache_GetInteger(&sDogFollowsEverywhere)) {
             // Instead of stopping following when the dog gets too far, just speed them up.
             speed = this->actor.xzDistToPlayer / 25.0f;
         } else {
@@ -417,7 +420,7 @@ void EnDog_FollowPlayer(EnDog* this, PlayState* play) {
 
     Math_ApproachF(&this->actor.speedXZ, speed, 0.6f, 1.0f);
 
-    if (!(this->actor.xzDistToPlayer > 400.0f) || CVarGetInteger("gDogFollowsEverywhere", 0)) {
+    if (!(this->actor.xzDistToPlayer > 400.0f) || CVarCache_GetInteger(&sDogFollowsEverywhere)) {
         Math_SmoothStepToS(&this->actor.world.rot.y, this->actor.yawTowardsPlayer, 10, 1000, 1);
         this->actor.shape.rot = this->actor.world.rot;
     }
@@ -13,6 +13,9 @@
 #include "objects/object_tsubo/object_tsubo.h"
 #include "objects/object_gi_rupy/object_gi_rupy.h"
 #include "soh/frame_interpolation.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sNewDrops = CVAR_CACHED_INT("gNewDrops", 0);
 
 #define FLAGS (ACTOR_FLAG_4 | ACTOR_FLAG_5)
 
@@ -120,7 +123,7 @@ void EnGSwitch_Init(Actor* thisx, PlayState* play) {
             this->actor.draw = EnGSwitch_DrawRupee;
             this->actor.shape.yOffset = 700.0f;
 
-            if (CVarGetInteger("gNewDrops", 0) !=0) {
+            if (CVarCache_GetInteger(&sNewDrops) !=0) {
                 this->actor.shape.yOffset = 35.0f;
             } else {
                 this->actor.shape.yOffset = 700.0f;
@@ -130,7 +133,7 @@ void EnGSwitch_Init(Actor* thisx, PlayState* play) {
                 osSyncPrintf(VT_FGCOL(GREEN) "☆☆☆☆☆ Ｙｏｕ ａｒｅ Ｓｈｏｃｋ！  ☆☆☆☆☆ %d\n" VT_RST, this->switchFlag);
                 Actor_Kill(&this->actor);
             } else {
-                if (CVarGetInteger("gNewDrops", 0) !=0) {
+                if (CVarCache_GetInteger(&sNewDrops) !=0) {
                     Actor_SetScale(&this->actor, 0.6f);
                 } else {
                     Actor_SetScale(&this->actor, 0.03f);
@@ -165,7 +168,7 @@ void EnGSwitch_Init(Actor* thisx, PlayState* play) {
             this->actionFunc = EnGSwitch_WaitForObject;
             break;
         case ENGSWITCH_TARGET_RUPEE:
-            if (CVarGetInteger("gNewDrops", 0) !=0) {
+            if (CVarCache_GetInteger(&sNewDrops) !=0) {
                 this->actor.shape.yOffset = 35.0f;
                 Actor_SetScale(&this->actor, 0.9f);
             } else {
@@ -498,7 +501,7 @@ void EnGSwitch_DrawRupee(Actor* thisx, PlayState* play) {
         Gfx_SetupDL_25Opa(play->state.gfxCtx);
         func_8002EBCC(&this->actor, play, 0);
         gSPMatrix(POLY_OPA_DISP++, MATRIX_NEWMTX(play->state.gfxCtx), G_MTX_NOPUSH | G_MTX_LOAD | G_MTX_MODELVIEW);
-        if (CVarGetInteger("gNewDrops", 0) !=0) {
+        if (CVarCache_GetInteger(&sNewDrops) !=0) {
             gSPMatrix(POLY_OPA_DISP++, MATRIX_NEWMTX(play->state.gfxCtx), G_MTX_MODELVIEW | G_MTX_LOAD);
             if (this->type == ENGSWITCH_TARGET_RUPEE) {
                 GetItem_Draw(play, sRupeeTexturesNew[this->colorIdx]);
@@ -11,6 +11,9 @@
 #include "objects/object_kw1/object_kw1.h"
 #include "vt.h"
 #include "soh/Enhancements/randomizer/adult_trade_shuffle.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sDisableKokiriDrawDistance = CVAR_CACHED_INT("gDisableKokiriDrawDistance", 0);
 
 #define FLAGS (ACTOR_FLAG_0 | ACTOR_FLAG_3 | ACTOR_FLAG_4)
 
@@ -1095,7 +1098,7 @@ void func_80A98DB4(EnKo* this, PlayState* play) {
         dist = this->actor.xzDistToPlayer;
     }
 
-    if (CVarGetInteger("gDisableKokiriDrawDistance", 0) != 0) {
+    if (CVarCache_GetInteger(&sDisableKokiriDrawDistance) != 0) {
         this->appearDist = 32767.0f;
         Math_SmoothStepToF(&this->modelAlpha, (this->appearDist < dist) ? 0.0f : 255.0f, 0.3f, 40.0f, 1.0f);
         f32 test = this->appearDist;
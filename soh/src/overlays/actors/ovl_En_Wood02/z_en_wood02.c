@@ -6,6 +6,9 @@
 
 #include "z_en_wood02.h"
 #include "objects/object_wood02/object_wood02.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sDisableDrawDistance = CVAR_CACHED_INT("gDisableDrawDistance", 0);
 
 #define FLAGS 0
 
@@ -101,7 +104,7 @@ static f32 sSpawnSin;
 s32 EnWood02_SpawnZoneCheck(EnWood02* this, PlayState* play, Vec3f* pos) {
     f32 phi_f12;
 
-    if (CVarGetInteger("gDisableDrawDistance", 0) != 0) {
+    if (CVarCache_GetInteger(&sDisableDrawDistance) != 0) {
         return true;
     }
 
@@ -5,6 +5,9 @@
  */
 
 #include "z_obj_mure2.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sDisableDrawDistance = CVAR_CACHED_INT("gDisableDrawDistance", 0);
 
 #define FLAGS 0
 
@@ -191,7 +194,7 @@ void func_80B9A658(ObjMure2* this) {
 void func_80B9A668(ObjMure2* this, PlayState* play) {
     if (Math3D_Dist1DSq(this->actor.projectedPos.x, this->actor.projectedPos.z) <
             (sDistSquared1[this->actor.params & 3] * this->unk_184) ||
-        CVarGetInteger("gDisableDrawDistance", 0) != 0) {
+        CVarCache_GetInteger(&sDisableDrawDistance) != 0) {
         this->actor.flags |= ACTOR_FLAG_4;
         ObjMure2_SpawnActors(this, play);
         func_80B9A6E8(this);
@@ -205,7 +208,7 @@ void func_80B9A6E8(ObjMure2* this) {
 void func_80B9A6F8(ObjMure2* this, PlayState* play) {
     func_80B9A534(this);
 
-    if (CVarGetInteger("gDisableDrawDistance", 0) != 0) {
+    if (CVarCache_GetInteger(&sDisableDrawDistance) != 0) {
         return;
     }
 
@@ -24,6 +24,36 @@
 #include "soh/Enhancements/item-tables/ItemTableTypes.h"
 #include "soh/Enhancements/game-interactor/GameInteractor.h"
 #include "soh/Enhancements/randomizer/randomizer_entrance.h"
+#include "soh/Enhancements/cvar_cache.h"
+
+static CVarCachedInt sDpadEquips = CVAR_CACHED_INT("gDpadEquips", 0);
+static CVarCachedInt sVSOAPosType = CVAR_CACHED_INT("gVSOAPosType", 0);
+static CVarCachedInt sVSOAUseMargins = CVAR_CACHED_INT("gVSOAUseMargins", 0);
+static CVarCachedInt sVSOAPosX = CVAR_CACHED_INT("gVSOAPosX", 0);
+static CVarCachedInt sVSOAPosY = CVAR_CACHED_INT("gVSOAPosY", 0);
+static CVarCachedInt sShieldTwoHanded = CVAR_CACHED_INT("gShieldTwoHanded", 0);
+static CVarCachedInt sMMBunnyHood = CVAR_CACHED_INT("gMMBunnyHood", 0);
+static CVarCachedInt sWalkSpeedToggle = CVAR_CACHED_INT("gWalkSpeedToggle", 0);
+static CVarCachedInt sEnableWalkModify = CVAR_CACHED_INT("gEnableWalkModify", 0);
+static CVarCachedInt sSuperTunic = CVAR_CACHED_INT("gSuperTunic", 0);
+static CVarCachedInt sInvertAimingYAxis = CVAR_CACHED_INT("gInvertAimingYAxis", 1);
+static CVarCachedInt sInvertAimingXAxis = CVAR_CACHED_INT("gInvertAimingXAxis", 0);
+static CVarCachedInt sRightStickAiming = CVAR_CACHED_INT("gRightStickAiming", 0);
+static CVarCachedInt sNaviOnL = CVAR_CACHED_INT("gNaviOnL", 0);
+static CVarCachedInt sTimelessEquipment = CVAR_CACHED_INT("gTimelessEquipment", 0);
+static CVarCachedInt sClimbEverything = CVAR_CACHED_INT("gClimbEverything", 0);
+static CVarCachedInt sDisableLOD = CVAR_CACHED_INT("gDisableLOD", 0);
+static CVarCachedInt sTwoHandedIdle = CVAR_CACHED_INT("gTwoHandedIdle", 0);
+static CVarCachedInt sDisableAutoCenterViewFirstPerson = CVAR_CACHED_INT("gDisableAutoCenterViewFirstPerson", 0);
+static CVarCachedInt sHUDMargin_T = CVAR_CACHED_INT("gHUDMargin_T", 0);
+static CVarCachedInt sHUDMargin_R = CVAR_CACHED_INT("gHUDMargin_R", 0);
+static CVarCachedInt sHUDMargin_L = CVAR_CACHED_INT("gHUDMargin_L", 0);
+static CVarCachedInt sVisualAgony = CVAR_CACHED_INT("gVisualAgony", 0);
+static CVarCachedInt sClimbSpeed = CVAR_CACHED_INT("gClimbSpeed", 0);
+static CVarCachedInt sFastDrops = CVAR_CACHED_INT("gFastDrops", 0);
+static CVarCachedInt sFasterHeavyBlockLift = CVAR_CACHED_INT("gFasterHeavyBlockLift", 0);
+static CVarCachedInt sDogFollowsEverywhere = CVAR_CACHED_INT("gDogFollowsEverywhere", 0);
+static CVarCachedInt sHoverFishing = CVAR_CACHED_INT("gHoverFishing", 0);
 
 typedef enum {
     /* 0x00 */ KNOB_ANIM_ADULT_L,
@@ -2018,7 +2048,7 @@ s32 func_80833C98(s32 item1, s32 actionParam) {
 }
 
 s32 func_80833CDC(PlayState* play, s32 index) {
-    if (index >= ((CVarGetInteger("gDpadEquips", 0) != 0) ? 8 : 4)) {
+    if (index >= ((CVarCache_GetInteger(&sDpadEquips) != 0) ? 8 : 4)) {
         return ITEM_NONE;
     } else if (play->bombchuBowlingStatus != 0) {
         return (play->bombchuBowlingStatus > 0) ? ITEM_BOMBCHU : ITEM_NONE;
@@ -2047,10 +2077,10 @@ void func_80833DF8(Player* this, PlayState* play) {
     s32 i;
 
     if (this->currentMask != PLAYER_MASK_NONE) {
-        if (CVarGetInteger("gMMBunnyHood", 0) != 0) {
+        if (CVarCache_GetInteger(&sMMBunnyHood) != 0) {
             s32 maskItem = this->currentMask - PLAYER_MASK_KEATON + ITEM_MASK_KEATON;
             bool hasOnDpad = false;
-            if (CVarGetInteger("gDpadEquips", 0) != 0) {
+            if (CVarCache_GetInteger(&sDpadEquips) != 0) {
                 for (int buttonIndex = 4; buttonIndex < 8; buttonIndex++) {
                     hasOnDpad |= gSaveContext.equips.buttonItems[buttonIndex] == maskItem;
                 }
@@ -2065,7 +2095,7 @@ void func_80833DF8(Player* this, PlayState* play) {
         } else {
             maskActionParam = this->currentMask - 1 + PLAYER_IA_MASK_KEATON;
             bool hasOnDpad = false;
-            if (CVarGetInteger("gDpadEquips", 0) != 0) {
+            if (CVarCache_GetInteger(&sDpadEquips) != 0) {
                 for (int buttonIndex = 0; buttonIndex < 4; buttonIndex++) {
                     hasOnDpad |= func_80833C98(DPAD_ITEM(buttonIndex), maskActionParam);
                 }
@@ -2080,7 +2110,7 @@ void func_80833DF8(Player* this, PlayState* play) {
     if (!(this->stateFlags1 & (PLAYER_STATE1_11 | PLAYER_STATE1_29)) && !func_8008F128(this)) {
         if (this->itemAction >= PLAYER_IA_FISHING_POLE) {
             bool hasOnDpad = false;
-            if (CVarGetInteger("gDpadEquips", 0) != 0) {
+            if (CVarCache_GetInteger(&sDpadEquips) != 0) {
                 for (int buttonIndex = 0; buttonIndex < 4; buttonIndex++) {
                     hasOnDpad |= func_80833C50(this, DPAD_ITEM(buttonIndex));
                 }
@@ -2283,10 +2313,10 @@ LinkAnimationHeader* func_808346C4(PlayState* play, Player* this) {
 
     if (this->unk_870 < 0.5f) {
         return D_808543A4[Player_HoldsTwoHandedWeapon(this) &&
-                          !(CVarGetInteger("gShieldTwoHanded", 0) && (this->heldItemAction != PLAYER_IA_STICK))];
+                          !(CVarCache_GetInteger(&sShieldTwoHanded) && (this->heldItemAction != PLAYER_IA_STICK))];
     } else {
         return D_808543AC[Player_HoldsTwoHandedWeapon(this) &&
-                          !(CVarGetInteger("gShieldTwoHanded", 0) && (this->heldItemAction != PLAYER_IA_STICK))];
+                          !(CVarCache_GetInteger(&sShieldTwoHanded) && (this->heldItemAction != PLAYER_IA_STICK))];
     }
 }
 
@@ -2462,7 +2492,7 @@ s32 func_80834E44(PlayState* play) {
 
 s32 func_80834E7C(PlayState* play) {
     u16 buttonsToCheck = BTN_A | BTN_B | BTN_CUP | BTN_CLEFT | BTN_CRIGHT | BTN_CDOWN;
-    if (CVarGetInteger("gDpadEquips", 0) != 0) {
+    if (CVarCache_GetInteger(&sDpadEquips) != 0) {
         buttonsToCheck |= BTN_DUP | BTN_DDOWN | BTN_DLEFT | BTN_DRIGHT;
     }
     return (play->shootingGalleryStatus != 0) &&
@@ -3959,18 +3989,18 @@ s32 func_808382DC(Player* this, PlayState* play) {
 
                             if (this->unk_870 < 0.5f) {
                                 anim = D_808543BC[Player_HoldsTwoHandedWeapon(this) &&
-                                                  !(CVarGetInteger("gShieldTwoHanded", 0) &&
+                                                  !(CVarCache_GetInteger(&sShieldTwoHanded) &&
                                                     (this->heldItemAction != PLAYER_IA_STICK))];
                             } else {
                                 anim = D_808543B4[Player_HoldsTwoHandedWeapon(this) &&
-                                                  !(CVarGetInteger("gShieldTwoHanded", 0) &&
+                                                  !(CVarCache_GetInteger(&sShieldTwoHanded) &&
                                                     (this->heldItemAction != PLAYER_IA_STICK))];
                             }
                             LinkAnimation_PlayOnce(play, &this->skelAnime2, anim);
                         } else {
                             func_80832264(play, this,
                                           D_808543C4[Player_HoldsTwoHandedWeapon(this) &&
-                                                     !(CVarGetInteger("gShieldTwoHanded", 0) &&
+                                                     !(CVarCache_GetInteger(&sShieldTwoHanded) &&
                                                        (this->heldItemAction != PLAYER_IA_STICK))]);
                         }
                     }
@@ -4027,7 +4057,7 @@ s32 func_808382DC(Player* this, PlayState* play) {
                     ((sp48 >= 0) &&
                      SurfaceType_IsWallDamage(&play->colCtx, this->actor.floorPoly, this->actor.floorBgId) &&
                      (this->unk_A79 >= D_808544F4[sp48])) ||
-                    ((sp48 >= 0) && ((this->currentTunic != PLAYER_TUNIC_GORON && CVarGetInteger("gSuperTunic", 0) == 0) ||
+                    ((sp48 >= 0) && ((this->currentTunic != PLAYER_TUNIC_GORON && CVarCache_GetInteger(&sSuperTunic) == 0) ||
                                      (this->unk_A79 >= D_808544F4[sp48])))) {
                     this->unk_A79 = 0;
                     this->actor.colChkInfo.damage = 4;
@@ -4666,7 +4696,7 @@ void func_8083A0F4(PlayState* play, Player* this) {
 
             // Same actor is used for small and large silver rocks, use actor params to identify large ones
             bool isLargeSilverRock = interactActorId == ACTOR_EN_ISHI && interactRangeActor->params & 1 == 1;
-            if (CVarGetInteger("gFasterHeavyBlockLift", 0) && (isLargeSilverRock || interactActorId == ACTOR_BG_HEAVY_BLOCK)) {
+            if (CVarCache_GetInteger(&sFasterHeavyBlockLift) && (isLargeSilverRock || interactActorId == ACTOR_BG_HEAVY_BLOCK)) {
                 LinkAnimation_PlayOnceSetSpeed(play, &this->skelAnime, anim, 5.0f);
             } else {
                 LinkAnimation_PlayOnce(play, &this->skelAnime, anim);
@@ -4792,7 +4822,7 @@ s32 func_8083A6AC(Player* this, PlayState* play) {
 
         if (BgCheck_EntityLineTest1(&play->colCtx, &this->actor.world.pos, &sp74, &sp68, &sp84, true, false, false,
                                     true, &sp80) &&
-            ((ABS(sp84->normal.y) < 600) || (CVarGetInteger("gClimbEverything", 0) != 0))) {
+            ((ABS(sp84->normal.y) < 600) || (CVarCache_GetInteger(&sClimbEverything) != 0))) {
             f32 nx = COLPOLY_GET_NORMAL(sp84->normal.x);
             f32 ny = COLPOLY_GET_NORMAL(sp84->normal.y);
             f32 nz = COLPOLY_GET_NORMAL(sp84->normal.z);
@@ -5204,7 +5234,7 @@ s32 func_8083B644(Player* this, PlayState* play) {
                             this->stateFlags2 |= PLAYER_STATE2_21;
                         }
 
-                        if (!CHECK_BTN_ALL(sControlInput->press.button, CVarGetInteger("gNaviOnL", 0) ? BTN_L : BTN_CUP) &&
+                        if (!CHECK_BTN_ALL(sControlInput->press.button, CVarCache_GetInteger(&sNaviOnL) ? BTN_L : BTN_CUP) &&
                             !sp28) {
                             return 0;
                         }
@@ -5258,7 +5288,7 @@ s32 func_8083B998(Player* this, PlayState* play) {
     if ((this->unk_664 != NULL) &&
         (CHECK_FLAG_ALL(this->unk_664->flags, ACTOR_FLAG_0 | ACTOR_FLAG_18) || (this->unk_664->naviEnemyId != 0xFF))) {
         this->stateFlags2 |= PLAYER_STATE2_21;
-    } else if ((this->naviTextId == 0 || CVarGetInteger("gNaviOnL", 0)) && !func_8008E9C4(this) &&
+    } else if ((this->naviTextId == 0 || CVarCache_GetInteger(&sNaviOnL)) && !func_8008E9C4(this) &&
                CHECK_BTN_ALL(sControlInput->press.button, BTN_CUP) && (YREG(15) != 0x10) && (YREG(15) != 0x20) &&
                !func_8083B8F4(this, play)) {
         func_80078884(NA_SE_SY_ERROR);
@@ -5573,7 +5603,7 @@ s32 func_8083C6B8(PlayState* play, Player* this) {
             sp24 = this->actor.world.pos;
             sp24.y += 50.0f;
 
-            if (CVarGetInteger("gHoverFishing", 0)
+            if (CVarCache_GetInteger(&sHoverFishing)
                     ? 0
                     : !(this->actor.bgCheckFlags & 1) || (this->actor.world.pos.z > 1300.0f) ||
                           BgCheck_SphVsFirstPoly(&play->colCtx, &sp24, 20.0f)) {
@@ -6095,12 +6125,12 @@ void func_8083DFE0(Player* this, f32* arg1, s16* arg2) {
             }
         }
 
-        if (CVarGetInteger("gMMBunnyHood", 0) == 1 && this->currentMask == PLAYER_MASK_BUNNY) {
+        if (CVarCache_GetInteger(&sMMBunnyHood) == 1 && this->currentMask == PLAYER_MASK_BUNNY) {
             maxSpeed *= 1.5f;
         } 
         
-        if (CVarGetInteger("gEnableWalkModify", 0)) {
-            if (CVarGetInteger("gWalkSpeedToggle", 0)) {
+        if (CVarCache_GetInteger(&sEnableWalkModify)) {
+            if (CVarCache_GetInteger(&sWalkSpeedToggle)) {
                 if (gWalkSpeedToggle1) {
                     maxSpeed *= CVarGetFloat("gWalkModifierOne", 1.0f);
                 } else if (gWalkSpeedToggle2) {
@@ -6336,7 +6366,7 @@ s32 func_8083E5A8(Player* this, PlayState* play) {
 
                 // Skip cutscenes from picking up consumables with "Fast Pickup Text" enabled, even when the player never picked it up before.
                 // But only for bushes/rocks/enemies because otherwise it can lead to softlocks in deku mask theatre and potentially other places.
-                uint8_t skipItemCutscene = CVarGetInteger("gFastDrops", 0) && isDropToSkip;
+                uint8_t skipItemCutscene = CVarCache_GetInteger(&sFastDrops) && isDropToSkip;
 
                 // Same as above but for rando. Rando is different because we want to enable cutscenes for items that the player already has because
                 // those items could be a randomized item coming from scrubs, freestanding PoH's and keys. So we need to once again overrule
@@ -6463,7 +6493,7 @@ s32 func_8083EAF0(Player* this, Actor* actor) {
 
 s32 func_8083EB44(Player* this, PlayState* play) {
     u16 buttonsToCheck = BTN_A | BTN_B | BTN_CLEFT | BTN_CRIGHT | BTN_CDOWN;
-    if (CVarGetInteger("gDpadEquips", 0) != 0) {
+    if (CVarCache_GetInteger(&sDpadEquips) != 0) {
         buttonsToCheck |= BTN_DUP | BTN_DDOWN | BTN_DLEFT | BTN_DRIGHT;
     }
     if ((this->stateFlags1 & PLAYER_STATE1_11) && (this->heldActor != NULL) &&
@@ -7190,7 +7220,7 @@ void func_808409CC(PlayState* play, Player* this) {
                 if (sp34 < 4) {
                     if (((sp34 != 0) && (sp34 != 3)) || ((this->rightHandType == PLAYER_MODELTYPE_RH_SHIELD) &&
                                                          ((sp34 == 3) || Player_GetSwordHeld(this)))) {
-                        if ((sp34 == 1) && Player_HoldsTwoHandedWeapon(this) && CVarGetInteger("gTwoHandedIdle", 0) == 1) {
+                        if ((sp34 == 1) && Player_HoldsTwoHandedWeapon(this) && CVarCache_GetInteger(&sTwoHandedIdle) == 1) {
                             sp34 = 4;
                         }
                         sp38 = sp34 + 9;
@@ -7733,12 +7763,12 @@ void func_80842180(Player* this, PlayState* play) {
                 }
             }
 
-            if (CVarGetInteger("gMMBunnyHood", 0) && this->currentMask == PLAYER_MASK_BUNNY) {
+            if (CVarCache_GetInteger(&sMMBunnyHood) && this->currentMask == PLAYER_MASK_BUNNY) {
                 sp2C *= 1.5f;
             } 
             
-            if (CVarGetInteger("gEnableWalkModify", 0)) {
-                if (CVarGetInteger("gWalkSpeedToggle", 0)) {
+            if (CVarCache_GetInteger(&sEnableWalkModify)) {
+                if (CVarCache_GetInteger(&sWalkSpeedToggle)) {
                     if (gWalkSpeedToggle1) {
                         sp2C *= CVarGetFloat("gWalkModifierOne", 1.0f);
                     } else if (gWalkSpeedToggle2) {
@@ -8395,7 +8425,7 @@ static struct_80832924 D_808545F0[] = {
 };
 
 void func_80843CEC(Player* this, PlayState* play) {
-    if (this->currentTunic != PLAYER_TUNIC_GORON && CVarGetInteger("gSuperTunic", 0) == 0) {
+    if (this->currentTunic != PLAYER_TUNIC_GORON && CVarCache_GetInteger(&sSuperTunic) == 0) {
         if ((play->roomCtx.curRoom.behaviorType2 == ROOM_BEHAVIOR_TYPE2_3) || (D_808535E4 == 9) ||
             ((func_80838144(D_808535E4) >= 0) &&
              !SurfaceType_IsWallDamage(&play->colCtx, this->actor.floorPoly, this->actor.floorBgId))) {
@@ -8522,7 +8552,7 @@ void func_8084411C(Player* this, PlayState* play) {
             Actor* heldActor = this->heldActor;
 
             u16 buttonsToCheck = BTN_A | BTN_B | BTN_CLEFT | BTN_CRIGHT | BTN_CDOWN;
-            if (CVarGetInteger("gDpadEquips", 0) != 0) {
+            if (CVarCache_GetInteger(&sDpadEquips) != 0) {
                 buttonsToCheck |= BTN_DUP | BTN_DDOWN | BTN_DLEFT | BTN_DRIGHT;
             }
             if (!func_80835644(play, this, heldActor) && (heldActor->id == ACTOR_EN_NIW) &&
@@ -9275,7 +9305,7 @@ void func_80846120(Player* this, PlayState* play) {
     if (LinkAnimation_OnFrame(&this->skelAnime, 229.0f)) {
         Actor* heldActor = this->heldActor;
 
-        if (CVarGetInteger("gFasterHeavyBlockLift", 0)) {
+        if (CVarCache_GetInteger(&sFasterHeavyBlockLift)) {
             // This is the difference in rotation when the animation is sped up 5x
             heldActor->shape.rot.x -= 3510;
         }
@@ -9300,7 +9330,7 @@ void func_80846260(Player* this, PlayState* play) {
     }
 
     u16 buttonsToCheck = BTN_A | BTN_B | BTN_CLEFT | BTN_CRIGHT | BTN_CDOWN;
-    if (CVarGetInteger("gDpadEquips", 0) != 0) {
+    if (CVarCache_GetInteger(&sDpadEquips) != 0) {
         buttonsToCheck |= BTN_DUP | BTN_DDOWN | BTN_DLEFT | BTN_DRIGHT;
     }
     if (this->unk_850 == 0) {
@@ -9630,7 +9660,7 @@ void Player_Init(Actor* thisx, PlayState* play2) {
     func_80835F44(play, this, ITEM_NONE);
     Player_SetEquipmentData(play, this);
     this->prevBoots = this->currentBoots;
-    if (CVarGetInteger("gMMBunnyHood", 0)) {
+    if (CVarCache_GetInteger(&sMMBunnyHood)) {
         if (INV_CONTENT(ITEM_TRADE_CHILD) == ITEM_SOLD_OUT) {
             sMaskMemory = PLAYER_MASK_NONE;
         }
@@ -9638,7 +9668,7 @@ void Player_Init(Actor* thisx, PlayState* play2) {
         for (uint16_t cSlotIndex = 0; cSlotIndex < ARRAY_COUNT(gSaveContext.equips.cButtonSlots); cSlotIndex++) {
             if (gSaveContext.equips.cButtonSlots[cSlotIndex] == SLOT_TRADE_CHILD &&
                 (gItemAgeReqs[gSaveContext.equips.buttonItems[cSlotIndex + 1]] != 9 && LINK_IS_ADULT &&
-                 !CVarGetInteger("gTimelessEquipment", 0))) {
+                 !CVarCache_GetInteger(&sTimelessEquipment))) {
                 gSaveContext.equips.cButtonSlots[cSlotIndex] = SLOT_NONE;
                 gSaveContext.equips.buttonItems[cSlotIndex + 1] = ITEM_NONE;
             }
@@ -10095,7 +10125,7 @@ void func_80847BA0(PlayState* play, Player* this) {
         if ((this->actor.bgCheckFlags & 0x200) && (D_80853608 < 0x3000)) {
             CollisionPoly* wallPoly = this->actor.wallPoly;
 
-            if ((ABS(wallPoly->normal.y) < 600) || (CVarGetInteger("gClimbEverything", 0) != 0)) {
+            if ((ABS(wallPoly->normal.y) < 600) || (CVarCache_GetInteger(&sClimbEverything) != 0)) {
                 f32 sp8C = COLPOLY_GET_NORMAL(wallPoly->normal.x);
                 f32 sp88 = COLPOLY_GET_NORMAL(wallPoly->normal.y);
                 f32 sp84 = COLPOLY_GET_NORMAL(wallPoly->normal.z);
@@ -10364,7 +10394,7 @@ void func_80848C74(PlayState* play, Player* this) {
     s32 sp58;
     s32 sp54;
 
-    if (this->currentTunic == PLAYER_TUNIC_GORON || CVarGetInteger("gSuperTunic", 0) != 0) {
+    if (this->currentTunic == PLAYER_TUNIC_GORON || CVarCache_GetInteger(&sSuperTunic) != 0) {
         sp54 = 20;
     } else {
         sp54 = (s32)(this->linearVelocity * 0.4f) + 1;
@@ -10436,14 +10466,14 @@ void func_80848EF8(Player* this, PlayState* play) {
         if (CVarGetInteger("gCosmetics.Hud_StoneOfAgony.Changed", 0)) {
             stoneOfAgonyColor = CVarGetColor24("gCosmetics.Hud_StoneOfAgony.Value", stoneOfAgonyColor);
         }
-        if (CVarGetInteger("gVisualAgony", 0) != 0 && !this->stateFlags1) {
-            s16 Top_Margins = (CVarGetInteger("gHUDMargin_T", 0) * -1);
-            s16 Left_Margins = CVarGetInteger("gHUDMargin_L", 0);
-            s16 Right_Margins = CVarGetInteger("gHUDMargin_R", 0);
+        if (CVarCache_GetInteger(&sVisualAgony) != 0 && !this->stateFlags1) {
+            s16 Top_Margins = (CVarCache_GetInteger(&sHUDMargin_T) * -1);
+            s16 Left_Margins = CVarCache_GetInteger(&sHUDMargin_L);
+            s16 Right_Margins = CVarCache_GetInteger(&sHUDMargin_R);
             s16 X_Margins_VSOA;
             s16 Y_Margins_VSOA;
-            if (CVarGetInteger("gVSOAUseMargins", 0) != 0) {
-                if (CVarGetInteger("gVSOAPosType", 0) == 0) {
+            if (CVarCache_GetInteger(&sVSOAUseMargins) != 0) {
+                if (CVarCache_GetInteger(&sVSOAPosType) == 0) {
                     X_Margins_VSOA = Left_Margins;
                 };
                 Y_Margins_VSOA = Top_Margins;
@@ -10455,21 +10485,21 @@ void func_80848EF8(Player* this, PlayState* play) {
             s16 PosY_VSOA_ori = 60 + Y_Margins_VSOA;
             s16 PosX_VSOA;
             s16 PosY_VSOA;
-            if (CVarGetInteger("gVSOAPosType", 0) != 0) {
-                PosY_VSOA = CVarGetInteger("gVSOAPosY", 0) + Y_Margins_VSOA;
-                if (CVarGetInteger("gVSOAPosType", 0) == 1) { // Anchor Left
-                    if (CVarGetInteger("gVSOAUseMargins", 0) != 0) {
+            if (CVarCache_GetInteger(&sVSOAPosType) != 0) {
+                PosY_VSOA = CVarCache_GetInteger(&sVSOAPosY) + Y_Margins_VSOA;
+                if (CVarCache_GetInteger(&sVSOAPosType) == 1) { // Anchor Left
+                    if (CVarCache_GetInteger(&sVSOAUseMargins) != 0) {
                         X_Margins_VSOA = Left_Margins;
                     };
-                    PosX_VSOA = OTRGetDimensionFromLeftEdge(CVarGetInteger("gVSOAPosX", 0) + X_Margins_VSOA);
-                } else if (CVarGetInteger("gVSOAPosType", 0) == 2) { // Anchor Right
-                    if (CVarGetInteger("gVSOAUseMargins", 0) != 0) {
+                    PosX_VSOA = OTRGetDimensionFromLeftEdge(CVarCache_GetInteger(&sVSOAPosX) + X_Margins_VSOA);
+                } else if (CVarCache_GetInteger(&sVSOAPosType) == 2) { // Anchor Right
+                    if (CVarCache_GetInteger(&sVSOAUseMargins) != 0) {
                         X_Margins_VSOA = Right_Margins;
                     };
-                    PosX_VSOA = OTRGetDimensionFromRightEdge(CVarGetInteger("gVSOAPosX", 0) + X_Margins_VSOA);
-                } else if (CVarGetInteger("gVSOAPosType", 0) == 3) { // Anchor None
-                    PosX_VSOA = CVarGetInteger("gVSOAPosX", 0);
-                } else if (CVarGetInteger("gVSOAPosType", 0) == 4) { // Hidden
+                    PosX_VSOA = OTRGetDimensionFromRightEdge(CVarCache_GetInteger(&sVSOAPosX) + X_Margins_VSOA);
+                } else if (CVarCache_GetInteger(&sVSOAPosType) == 3) { // Anchor None
+                    PosX_VSOA = CVarCache_GetInteger(&sVSOAPosX);
+                } else if (CVarCache_GetInteger(&sVSOAPosType) == 4) { // Hidden
                     PosX_VSOA = -9999;
                 }
             } else {
@@ -10520,7 +10550,7 @@ void func_80848EF8(Player* this, PlayState* play) {
 
         if (this->unk_6A0 > 4000000.0f) {
             this->unk_6A0 = 0.0f;
-            if (CVarGetInteger("gVisualAgony", 0) != 0 && !this->stateFlags1) {
+            if (CVarCache_GetInteger(&sVisualAgony) != 0 && !this->stateFlags1) {
                 // This audio is placed here and not in previous CVar check to prevent ears ra.. :)
                 Audio_PlaySoundGeneral(NA_SE_SY_MESSAGE_WOMAN, &D_801333D4, 4, &D_801333E0, &D_801333E0, &D_801333E0);
             }
@@ -10950,7 +10980,7 @@ void Player_Update(Actor* thisx, PlayState* play) {
     if (func_8084FCAC(this, play)) {
         if (gSaveContext.dogParams < 0) {
             // Disable object dependency to prevent losing dog in scenes other than market
-            if (Object_GetIndex(&play->objectCtx, OBJECT_DOG) < 0 && !CVarGetInteger("gDogFollowsEverywhere", 0)) {
+            if (Object_GetIndex(&play->objectCtx, OBJECT_DOG) < 0 && !CVarCache_GetInteger(&sDogFollowsEverywhere)) {
                 gSaveContext.dogParams = 0;
             } else {
                 gSaveContext.dogParams &= 0x7FFF;
@@ -10961,7 +10991,7 @@ void Player_Update(Actor* thisx, PlayState* play) {
                                   sDogSpawnPos.z, 0, this->actor.shape.rot.y, 0, dogParams | 0x8000, true);
                 if (dog != NULL) {
                     // Room -1 allows actor to cross between rooms, similar to Navi
-                    dog->room = CVarGetInteger("gDogFollowsEverywhere", 0) ? -1 : 0;
+                    dog->room = CVarCache_GetInteger(&sDogFollowsEverywhere) ? -1 : 0;
                 }
             }
         }
@@ -10984,7 +11014,7 @@ void Player_Update(Actor* thisx, PlayState* play) {
             }
         }
 
-        if (CVarGetInteger("gEnableWalkModify", 0) && CVarGetInteger("gWalkSpeedToggle", 0)) {
+        if (CVarCache_GetInteger(&sEnableWalkModify) && CVarCache_GetInteger(&sWalkSpeedToggle)) {
             if (CHECK_BTN_ALL(sControlInput->press.button, BTN_MODIFIER1)) {
                 gWalkSpeedToggle1 = !gWalkSpeedToggle1;
             }
@@ -11177,7 +11207,7 @@ void Player_Draw(Actor* thisx, PlayState* play2) {
             lod = 1;
         }
 
-        if (CVarGetInteger("gDisableLOD", 0) != 0)
+        if (CVarCache_GetInteger(&sDisableLOD) != 0)
             lod = 0;
 
         func_80093C80(play);
@@ -11279,27 +11309,27 @@ s16 func_8084ABD8(PlayState* play, Player* this, s32 arg2, s16 arg3) {
     s16 temp2;
     s16 temp3;
 
-    if (!func_8002DD78(this) && !func_808334B4(this) && (arg2 == 0) && !CVarGetInteger("gDisableAutoCenterViewFirstPerson", 0)) {
-        temp2 = sControlInput->rel.stick_y * 240.0f * (CVarGetInteger("gInvertAimingYAxis", 1) ? 1 : -1); // Sensitivity not applied here because higher than default sensitivies will allow the camera to escape the autocentering, and glitch out massively
+    if (!func_8002DD78(this) && !func_808334B4(this) && (arg2 == 0) && !CVarCache_GetInteger(&sDisableAutoCenterViewFirstPerson)) {
+        temp2 = sControlInput->rel.stick_y * 240.0f * (CVarCache_GetInteger(&sInvertAimingYAxis) ? 1 : -1); // Sensitivity not applied here because higher than default sensitivies will allow the camera to escape the autocentering, and glitch out massively
         Math_SmoothStepToS(&this->actor.focus.rot.x, temp2, 14, 4000, 30);
 
-        temp2 = sControlInput->rel.stick_x * -16.0f * (CVarGetInteger("gInvertAimingXAxis", 0) ? -1 : 1) * (CVarGetFloat("gFirstPersonCameraSensitivityX", 1.0f));
+        temp2 = sControlInput->rel.stick_x * -16.0f * (CVarCache_GetInteger(&sInvertAimingXAxis) ? -1 : 1) * (CVarGetFloat("gFirstPersonCameraSensitivityX", 1.0f));
         temp2 = CLAMP(temp2, -3000, 3000);
         this->actor.focus.rot.y += temp2;
     } else {
         temp1 = (this->stateFlags1 & PLAYER_STATE1_23) ? 3500 : 14000;
         temp3 = ((sControlInput->rel.stick_y >= 0) ? 1 : -1) *
                 (s32)((1.0f - Math_CosS(sControlInput->rel.stick_y * 200)) * 1500.0f *
-                        (CVarGetInteger("gInvertAimingYAxis", 1) ? 1 : -1)) * (CVarGetFloat("gFirstPersonCameraSensitivityY", 1.0f));
+                        (CVarCache_GetInteger(&sInvertAimingYAxis) ? 1 : -1)) * (CVarGetFloat("gFirstPersonCameraSensitivityY", 1.0f));
         this->actor.focus.rot.x += temp3;
 
         if (fabsf(sControlInput->cur.gyro_x) > 0.01f) {
             this->actor.focus.rot.x -= (sControlInput->cur.gyro_x) * 750.0f;
         }
 
-        if (fabsf(sControlInput->cur.right_stick_y) > 15.0f && CVarGetInteger("gRightStickAiming", 0) != 0) {
+        if (fabsf(sControlInput->cur.right_stick_y) > 15.0f && CVarCache_GetInteger(&sRightStickAiming) != 0) {
             this->actor.focus.rot.x -=
-                (sControlInput->cur.right_stick_y) * 10.0f * (CVarGetInteger("gInvertAimingYAxis", 1) ? -1 : 1) * (CVarGetFloat("gFirstPersonCameraSensitivityY", 1.0f));
+                (sControlInput->cur.right_stick_y) * 10.0f * (CVarCache_GetInteger(&sInvertAimingYAxis) ? -1 : 1) * (CVarGetFloat("gFirstPersonCameraSensitivityY", 1.0f));
         }
 
         this->actor.focus.rot.x = CLAMP(this->actor.focus.rot.x, -temp1, temp1);
@@ -11308,7 +11338,7 @@ s16 func_8084ABD8(PlayState* play, Player* this, s32 arg2, s16 arg3) {
         temp2 = this->actor.focus.rot.y - this->actor.shape.rot.y;
         temp3 = ((sControlInput->rel.stick_x >= 0) ? 1 : -1) *
                 (s32)((1.0f - Math_CosS(sControlInput->rel.stick_x * 200)) * -1500.0f *
-                        (CVarGetInteger("gInvertAimingXAxis", 0) ? -1 : 1)) * (CVarGetFloat("gFirstPersonCameraSensitivityX", 1.0f));
+                        (CVarCache_GetInteger(&sInvertAimingXAxis) ? -1 : 1)) * (CVarGetFloat("gFirstPersonCameraSensitivityX", 1.0f));
         temp2 += temp3;
 
         this->actor.focus.rot.y = CLAMP(temp2, -temp1, temp1) + this->actor.shape.rot.y;
@@ -11317,9 +11347,9 @@ s16 func_8084ABD8(PlayState* play, Player* this, s32 arg2, s16 arg3) {
             this->actor.focus.rot.y += (sControlInput->cur.gyro_y) * 750.0f;
         }
 
-        if (fabsf(sControlInput->cur.right_stick_x) > 15.0f && CVarGetInteger("gRightStickAiming", 0) != 0) {
+        if (fabsf(sControlInput->cur.right_stick_x) > 15.0f && CVarCache_GetInteger(&sRightStickAiming) != 0) {
             this->actor.focus.rot.y +=
-                (sControlInput->cur.right_stick_x) * 10.0f * (CVarGetInteger("gInvertAimingXAxis", 0) ? 1 : -1) * (CVarGetFloat("gFirstPersonCameraSensitivityX", 1.0f));
+                (sControlInput->cur.right_stick_x) * 10.0f * (CVarCache_GetInteger(&sInvertAimingXAxis) ? 1 : -1) * (CVarGetFloat("gFirstPersonCameraSensitivityX", 1.0f));
         }
     }
 
@@ -11431,7 +11461,7 @@ void func_8084B1D8(Player* this, PlayState* play) {
     }
 
     u16 buttonsToCheck = BTN_A | BTN_B | BTN_R | BTN_CUP | BTN_CLEFT | BTN_CRIGHT | BTN_CDOWN;
-    if (CVarGetInteger("gDpadEquips", 0) != 0) {
+    if (CVarCache_GetInteger(&sDpadEquips) != 0) {
         buttonsToCheck |= BTN_DUP | BTN_DDOWN | BTN_DLEFT | BTN_DRIGHT;
     }
     if ((this->csMode != 0) || (this->unk_6AD == 0) || (this->unk_6AD >= 4) || func_80833B54(this) ||
@@ -11800,7 +11830,7 @@ void func_8084BF1C(Player* this, PlayState* play) {
         phi_f2 = -1.0f;
     }
 
-    this->skelAnime.playSpeed = phi_f2 * phi_f0 + phi_f2 * CVarGetInteger("gClimbSpeed", 0);
+    this->skelAnime.playSpeed = phi_f2 * phi_f0 + phi_f2 * CVarCache_GetInteger(&sClimbSpeed);
 
     if (this->unk_850 >= 0) {
         if ((this->actor.wallPoly != NULL) && (this->actor.wallBgId != BGCHECK_SCENE)) {
@@ -12607,7 +12637,7 @@ s32 func_8084DFF4(PlayState* play, Player* this) {
         equipNow = CVarGetInteger("gAskToEquip", 0) && giEntry.modIndex == MOD_NONE &&
                     equipItem >= ITEM_SWORD_KOKIRI && equipItem <= ITEM_TUNIC_ZORA &&
                    ((gItemAgeReqs[equipItem] == 9 || gItemAgeReqs[equipItem] == gSaveContext.linkAge) ||
-                    CVarGetInteger("gTimelessEquipment", 0));
+                    CVarCache_GetInteger(&sTimelessEquipment));
 
         Message_StartTextbox(play, giEntry.textId, &this->actor);
         // RANDOTODO: Macro this boolean check.
@@ -13096,7 +13126,7 @@ void func_8084ECA4(Player* this, PlayState* play) {
     if (LinkAnimation_Update(play, &this->skelAnime)) {
         if (this->unk_84F != 0) {
             if (this->unk_850 == 0) {
-                if (CVarGetInteger("gFastDrops", 0)) {
+                if (CVarCache_GetInteger(&sFastDrops)) {
                     this->unk_84F = 0;
                 } else {
                     Message_StartTextbox(play, D_80854A04[this->unk_84F - 1].textId, &this->actor);
@@ -13135,7 +13165,7 @@ void func_8084ECA4(Player* this, PlayState* play) {
                             this->unk_850 = 0;
                             this->interactRangeActor->parent = &this->actor;
                             Player_UpdateBottleHeld(play, this, catchInfo->itemId, ABS(catchInfo->actionParam));
-                            if (!CVarGetInteger("gFastDrops", 0)) {
+                            if (!CVarCache_GetInteger(&sFastDrops)) {
                                 this->stateFlags1 |= PLAYER_STATE1_28 | PLAYER_STATE1_29;
                                 func_808322D0(play, this, sp24->unk_04);
                                 func_80835EA4(play, 4);
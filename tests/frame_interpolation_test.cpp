@@ -0,0 +1,358 @@
+// Records frames of a scene of skinned actors through frame_interpolation.cpp, the way the game's matrix functions do,
+// and replays the interpolated frames in between. Every recorded matrix has to be replaced, and the replacement has to
+// match drawing the scene directly at the interpolated actor positions and angles. Each frame starts with an unmatched
+// RecordCloseChild, which must not hide the rest of the frame. Prints the record and interpolate cost per frame.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "frame_interpolation.h"
+
+#define ACTORS 150
+#define LIMBS 20
+#define FRAMES 200
+// Interpolated frames per original frame, as at 60 fps
+#define STEPS 2
+
+#define MTXMODE_NEW 0
+#define MTXMODE_APPLY 1
+
+// Matrix stack standing in for sys_matrix.c. Only the functions frame_interpolation.cpp calls are implemented.
+
+static MtxF sMatrixStack[20];
+static MtxF* sCurrentMatrix = sMatrixStack;
+
+static void MtxFMult(const MtxF* a, const MtxF* b, MtxF* dest) {
+    MtxF result;
+
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            result.mf[i][j] = 0.0f;
+            for (int k = 0; k < 4; k++) {
+                result.mf[i][j] += a->mf[k][j] * b->mf[i][k];
+            }
+        }
+    }
+    *dest = result;
+}
+
+static void MtxFIdentity(MtxF* mf) {
+    memset(mf, 0, sizeof(MtxF));
+    for (int i = 0; i < 4; i++) {
+        mf->mf[i][i] = 1.0f;
+    }
+}
+
+static void Apply(MtxF* mf, u8 mode) {
+    if (mode == MTXMODE_APPLY) {
+        MtxFMult(sCurrentMatrix, mf, sCurrentMatrix);
+    } else {
+        *sCurrentMatrix = *mf;
+    }
+}
+
+static void MakeRotation(MtxF* mf, int axis, f32 angle) {
+    int a = (axis + 1) % 3;
+    int b = (axis + 2) % 3;
+
+    MtxFIdentity(mf);
+    mf->mf[a][a] = cosf(angle);
+    mf->mf[a][b] = sinf(angle);
+    mf->mf[b][a] = -sinf(angle);
+    mf->mf[b][b] = cosf(angle);
+}
+
+static f32 BinangToRad(s16 angle) {
+    return angle * (M_PI / 0x8000);
+}
+
+extern "C" {
+
+void Matrix_Push(void) {
+    sCurrentMatrix[1] = sCurrentMatrix[0];
+    sCurrentMatrix++;
+}
+
+void Matrix_Pop(void) {
+    sCurrentMatrix--;
+}
+
+void Matrix_Put(MtxF* src) {
+    *sCurrentMatrix = *src;
+}
+
+void Matrix_Mult(MtxF* mf, u8 mode) {
+    Apply(mf, mode);
+}
+
+void Matrix_Translate(f32 x, f32 y, f32 z, u8 mode) {
+    MtxF mf;
+
+    MtxFIdentity(&mf);
+    mf.mf[3][0] = x;
+    mf.mf[3][1] = y;
+    mf.mf[3][2] = z;
+    Apply(&mf, mode);
+}
+
+void Matrix_Scale(f32 x, f32 y, f32 z, u8 mode) {
+    MtxF mf;
+
+    MtxFIdentity(&mf);
+    mf.mf[0][0] = x;
+    mf.mf[1][1] = y;
+    mf.mf[2][2] = z;
+    Apply(&mf, mode);
+}
+
+void Matrix_RotateX(f32 x, u8 mode) {
+    MtxF mf;
+
+    MakeRotation(&mf, 0, x);
+    Apply(&mf, mode);
+}
+
+void Matrix_RotateY(f32 y, u8 mode) {
+    MtxF mf;
+
+    MakeRotation(&mf, 1, y);
+    Apply(&mf, mode);
+}
+
+void Matrix_RotateZ(f32 z, u8 mode) {
+    MtxF mf;
+
+    MakeRotation(&mf, 2, z);
+    Apply(&mf, mode);
+}
+
+void Matrix_RotateZYX(s16 x, s16 y, s16 z, u8 mode) {
+    Matrix_RotateZ(BinangToRad(z), mode);
+    Matrix_RotateY(BinangToRad(y), MTXMODE_APPLY);
+    Matrix_RotateX(BinangToRad(x), MTXMODE_APPLY);
+}
+
+void Matrix_TranslateRotateZYX(Vec3f* translation, Vec3s* rotation) {
+    Matrix_Translate(translation->x, translation->y, translation->z, MTXMODE_APPLY);
+    Matrix_RotateZYX(rotation->x, rotation->y, rotation->z, MTXMODE_APPLY);
+}
+
+void Matrix_SetTranslateRotateYXZ(f32 translateX, f32 translateY, f32 translateZ, Vec3s* rot) {
+    Matrix_Translate(translateX, translateY, translateZ, MTXMODE_NEW);
+    Matrix_RotateY(BinangToRad(rot->y), MTXMODE_APPLY);
+    Matrix_RotateX(BinangToRad(rot->x), MTXMODE_APPLY);
+    Matrix_RotateZ(BinangToRad(rot->z), MTXMODE_APPLY);
+}
+
+void Matrix_ReplaceRotation(MtxF* mf) {
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            sCurrentMatrix->mf[i][j] = mf->mf[i][j];
+        }
+    }
+}
+
+void Matrix_RotateAxis(f32 angle, Vec3f* axis, u8 mode) {
+    Matrix_RotateY(angle * axis->y, mode);
+}
+
+MtxF* Matrix_GetCurrent(void) {
+    return sCurrentMatrix;
+}
+
+void SkinMatrix_MtxFMtxFMult(MtxF* mfA, MtxF* mfB, MtxF* dest) {
+    MtxFMult(mfA, mfB, dest);
+}
+
+int32_t CVarGetInteger(const char* name, int32_t defaultValue) {
+    return strcmp(name, "gInterpolationFPS") == 0 ? 60 : defaultValue;
+}
+
+}
+
+// The scene. Actors move and turn at a constant rate, their limbs keep their pose.
+
+struct Actor {
+    Vec3f pos;
+    Vec3f velocity;
+    s16 yaw;
+    s16 yawStep;
+};
+
+static Actor sActors[ACTORS];
+static Vec3f sLimbOffsets[LIMBS];
+static Vec3s sLimbRotations[LIMBS];
+// Matrices are written to alternating pools, like the game's double-buffered display list memory
+static Mtx sMtxPools[2][ACTORS * LIMBS];
+
+static uint32_t sRandState = 12345;
+
+static uint32_t Rand() {
+    sRandState = sRandState * 1664525u + 1013904223u;
+    return sRandState >> 8;
+}
+
+static f32 RandF(f32 range) {
+    return ((int)(Rand() % 2001) - 1000) * range / 1000.0f;
+}
+
+static void InitScene() {
+    for (Actor& actor : sActors) {
+        actor.pos = { RandF(2000.0f), RandF(200.0f), RandF(2000.0f) };
+        actor.velocity = { RandF(10.0f), RandF(2.0f), RandF(10.0f) };
+        actor.yaw = Rand() % 0x2000;
+        actor.yawStep = Rand() % 0x200;
+    }
+    for (int i = 0; i < LIMBS; i++) {
+        sLimbOffsets[i] = { RandF(50.0f), RandF(50.0f), RandF(50.0f) };
+        sLimbRotations[i] = { (s16)(Rand() % 0x4000), (s16)(Rand() % 0x4000), (s16)(Rand() % 0x4000) };
+    }
+}
+
+// The actor's position and yaw at frame. The yaw is returned unwrapped so that it can be interpolated across 0x8000.
+static void GetActorPose(const Actor& actor, int frame, Vec3f* pos, s32* yaw) {
+    pos->x = actor.pos.x + actor.velocity.x * frame;
+    pos->y = actor.pos.y + actor.velocity.y * frame;
+    pos->z = actor.pos.z + actor.velocity.z * frame;
+    *yaw = actor.yaw + actor.yawStep * frame;
+}
+
+// Draws one actor the way Actor_Draw and SkelAnime_Draw do, recording the matrix calls where sys_matrix.c does.
+// Records a ToMtx into dests for each limb unless it is NULL, and returns each limb's matrix in outMtxs if set.
+static void DrawActor(const Vec3f* pos, Vec3s* rot, Mtx* dests, MtxF* outMtxs) {
+    FrameInterpolation_RecordActorPosRotMatrix();
+    // Recorded after the fact, so that the actor matrix can be taken from the matrix stack
+    Matrix_SetTranslateRotateYXZ(pos->x, pos->y, pos->z, rot);
+    FrameInterpolation_RecordMatrixSetTranslateRotateYXZ(pos->x, pos->y, pos->z, rot);
+    FrameInterpolation_RecordMatrixScale(0.01f, 0.01f, 0.01f, MTXMODE_APPLY);
+    Matrix_Scale(0.01f, 0.01f, 0.01f, MTXMODE_APPLY);
+
+    for (int i = 0; i < LIMBS; i++) {
+        FrameInterpolation_RecordMatrixPush();
+        Matrix_Push();
+        FrameInterpolation_RecordMatrixTranslateRotateZYX(&sLimbOffsets[i], &sLimbRotations[i]);
+        Matrix_TranslateRotateZYX(&sLimbOffsets[i], &sLimbRotations[i]);
+        if (dests != NULL) {
+            FrameInterpolation_RecordMatrixToMtx(&dests[i], (char*)__FILE__, __LINE__);
+        }
+        if (outMtxs != NULL) {
+            outMtxs[i] = *Matrix_GetCurrent();
+        }
+        FrameInterpolation_RecordMatrixPop();
+        Matrix_Pop();
+    }
+}
+
+static void RecordFrame(int frame) {
+    Mtx* pool = sMtxPools[frame % 2];
+
+    FrameInterpolation_StartRecord();
+    FrameInterpolation_RecordCloseChild();
+    for (int i = 0; i < ACTORS; i++) {
+        Vec3f pos;
+        Vec3s rot;
+        s32 yaw;
+
+        GetActorPose(sActors[i], frame, &pos, &yaw);
+        rot = { 0, (s16)yaw, 0 };
+        FrameInterpolation_RecordOpenChild(&sActors[i], 0);
+        DrawActor(&pos, &rot, &pool[i * LIMBS], NULL);
+        FrameInterpolation_RecordCloseChild();
+    }
+    FrameInterpolation_StopRecord();
+}
+
+// Checks the interpolated matrices between frame - 1 and frame against drawing the scene at the interpolated pose
+static bool CheckFrame(int frame, float step, const std::vector<FrameInterpolationMtx>& replacements) {
+    Mtx* pool = sMtxPools[frame % 2];
+    MtxF expected[LIMBS];
+
+    if (replacements.size() != ACTORS * LIMBS) {
+        printf("frame %d: %zu matrices interpolated, expected %d\n", frame, replacements.size(), ACTORS * LIMBS);
+        return false;
+    }
+    for (int i = 0; i < ACTORS; i++) {
+        Vec3f oldPos, newPos, pos;
+        s32 oldYaw, newYaw;
+        Vec3s rot;
+
+        GetActorPose(sActors[i], frame - 1, &oldPos, &oldYaw);
+        GetActorPose(sActors[i], frame, &newPos, &newYaw);
+        pos.x = (1.0f - step) * oldPos.x + step * newPos.x;
+        pos.y = (1.0f - step) * oldPos.y + step * newPos.y;
+        pos.z = (1.0f - step) * oldPos.z + step * newPos.z;
+        rot = { 0, (s16)(s32)((1.0f - step) * oldYaw + step * newYaw), 0 };
+        DrawActor(&pos, &rot, NULL, expected);
+
+        for (int j = 0; j < LIMBS; j++) {
+            const FrameInterpolationMtx& replacement = replacements[i * LIMBS + j];
+
+            if (replacement.dest != &pool[i * LIMBS + j]) {
+                printf("frame %d: actor %d limb %d was not interpolated\n", frame, i, j);
+                return false;
+            }
+            for (int k = 0; k < 16; k++) {
+                f32 a = replacement.mtx.mf[k / 4][k % 4];
+                f32 b = expected[j].mf[k / 4][k % 4];
+
+                if (fabsf(a - b) > 1e-3f * (1.0f + fabsf(b))) {
+                    printf("frame %d step %.2f: actor %d limb %d element %d is %f, expected %f\n", frame, step, i, j,
+                           k, a, b);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static double MsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    std::vector<FrameInterpolationMtx> replacements;
+    std::unordered_map<Mtx*, MtxF> map;
+    double recordMs = 0;
+    double interpolateMs = 0;
+    double mapMs = 0;
+
+    InitScene();
+    RecordFrame(0);
+    for (int frame = 1; frame <= FRAMES; frame++) {
+        auto start = std::chrono::steady_clock::now();
+        RecordFrame(frame);
+        recordMs += MsSince(start);
+
+        for (int step = 1; step <= STEPS; step++) {
+            float t = (float)step / (STEPS + 1);
+
+            start = std::chrono::steady_clock::now();
+            FrameInterpolation_Interpolate(t, replacements);
+            interpolateMs += MsSince(start);
+
+            // What Graph_ProcessGfxCommands does to hand the matrices to gfx_run
+            start = std::chrono::steady_clock::now();
+            map.clear();
+            for (const auto& mtx : replacements) {
+                if (mtx.dest != nullptr) {
+                    map[mtx.dest] = mtx.mtx;
+                }
+            }
+            mapMs += MsSince(start);
+
+            if (!CheckFrame(frame, t, replacements)) {
+                return 1;
+            }
+        }
+    }
+
+    printf("%d frames of %d actors with %d limbs, %d interpolated frames each\n", FRAMES, ACTORS, LIMBS, STEPS);
+    printf("record: %.3f ms, interpolate: %.3f ms, gfx_run map: %.3f ms per frame\n", recordMs / FRAMES,
+           interpolateMs / (FRAMES * STEPS), mapMs / (FRAMES * STEPS));
+    return 0;
+}
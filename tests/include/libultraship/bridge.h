@@ -0,0 +1,15 @@
+#pragma once
+
+// The part of libultraship's bridge.h that frame_interpolation.cpp uses. frame_interpolation_test defines it.
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int32_t CVarGetInteger(const char* name, int32_t defaultValue);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+
+// The libultra types that frame_interpolation.cpp and the soh headers it includes use, so frame_interpolation_test
+// builds without pulling in the rest of libultraship.
+
+#include <stdint.h>
+
+typedef int8_t s8;
+typedef uint8_t u8;
+typedef int16_t s16;
+typedef uint16_t u16;
+typedef int32_t s32;
+typedef uint32_t u32;
+typedef int64_t s64;
+typedef uint64_t u64;
+typedef float f32;
+typedef double f64;
+
+typedef union {
+    float mf[4][4];
+} MtxF;
+
+typedef union {
+    int32_t m[4][4];
+} Mtx;
@@ -0,0 +1,15 @@
+#pragma once
+
+// The parts of libultraship's libultra/abi.h that mixer.c uses, so mixer_simd_test builds in a checkout without
+// libultraship. tests/CMakeLists.txt only puts this on the include path when the real header is missing.
+
+#include <stdint.h>
+
+typedef uint32_t u32;
+
+typedef short ADPCM_STATE[16];
+typedef short RESAMPLE_STATE[16];
+
+#define A_INIT 0x01
+#define A_CONTINUE 0x00
+#define A_LOOP 0x02
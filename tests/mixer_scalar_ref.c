@@ -0,0 +1,29 @@
+// Builds the scalar mixer under different names, so that mixer_simd_test can call it next to the SIMD build of mixer.c
+
+#define MIXER_NO_SIMD
+
+#define aClearBufferImpl Scalar_aClearBufferImpl
+#define aLoadBufferImpl Scalar_aLoadBufferImpl
+#define aSaveBufferImpl Scalar_aSaveBufferImpl
+#define aLoadADPCMImpl Scalar_aLoadADPCMImpl
+#define aSetBufferImpl Scalar_aSetBufferImpl
+#define aInterleaveImpl Scalar_aInterleaveImpl
+#define aDMEMMoveImpl Scalar_aDMEMMoveImpl
+#define aSetLoopImpl Scalar_aSetLoopImpl
+#define aADPCMdecImpl Scalar_aADPCMdecImpl
+#define aResampleImpl Scalar_aResampleImpl
+#define aEnvSetup1Impl Scalar_aEnvSetup1Impl
+#define aEnvSetup2Impl Scalar_aEnvSetup2Impl
+#define aEnvMixerImpl Scalar_aEnvMixerImpl
+#define aMixImpl Scalar_aMixImpl
+#define aS8DecImpl Scalar_aS8DecImpl
+#define aAddMixerImpl Scalar_aAddMixerImpl
+#define aDuplicateImpl Scalar_aDuplicateImpl
+#define aResampleZohImpl Scalar_aResampleZohImpl
+#define aInterlImpl Scalar_aInterlImpl
+#define aFilterImpl Scalar_aFilterImpl
+#define aHiLoGainImpl Scalar_aHiLoGainImpl
+#define aUnkCmd3Impl Scalar_aUnkCmd3Impl
+#define aUnkCmd19Impl Scalar_aUnkCmd19Impl
+
+#include "mixer.c"
@@ -0,0 +1,167 @@
+// Runs the SIMD mixer kernels and the scalar reference side by side on random buffers and parameters,
+// and fails on the first output that is not bit-identical.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mixer.h"
+
+// Mirrors the kernel selection at the top of mixer.c
+#if !defined(MIXER_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MIXER_TEST_PATH "SSE2"
+#elif !defined(MIXER_NO_SIMD) && defined(MIXER_ENABLE_NEON) && (defined(__ARM_NEON) || defined(_M_ARM64))
+#define MIXER_TEST_PATH "NEON"
+#endif
+
+// Returned when there is no SIMD path to compare, see SKIP_RETURN_CODE in tests/CMakeLists.txt
+#define TEST_SKIPPED 77
+
+#define ITERATIONS 200000
+#define BUF_START 0x3C0
+#define BUF_SIZE (0x1000 - 0x3C0 - 0x40)
+
+void Scalar_aLoadBufferImpl(const void* source_addr, uint16_t dest_addr, uint16_t nbytes);
+void Scalar_aSaveBufferImpl(uint16_t source_addr, int16_t* dest_addr, uint16_t nbytes);
+void Scalar_aSetBufferImpl(uint8_t flags, uint16_t in, uint16_t out, uint16_t nbytes);
+void Scalar_aInterleaveImpl(uint16_t dest, uint16_t left, uint16_t right, uint16_t c);
+void Scalar_aEnvSetup1Impl(uint8_t initial_vol_wet, uint16_t rate_wet, uint16_t rate_left, uint16_t rate_right);
+void Scalar_aEnvSetup2Impl(uint16_t initial_vol_left, uint16_t initial_vol_right);
+void Scalar_aEnvMixerImpl(uint16_t in_addr, uint16_t n_samples, bool swap_reverb, bool neg_3, bool neg_2,
+                          bool neg_left, bool neg_right, int32_t wet_dry_addr, u32 unk);
+void Scalar_aMixImpl(uint16_t count, int16_t gain, uint16_t in_addr, uint16_t out_addr);
+void Scalar_aS8DecImpl(uint8_t flags, ADPCM_STATE state);
+void Scalar_aAddMixerImpl(uint16_t count, uint16_t in_addr, uint16_t out_addr);
+
+static int16_t sInput[BUF_SIZE / 2];
+static int16_t sScalarOut[BUF_SIZE / 2];
+static int16_t sSimdOut[BUF_SIZE / 2];
+static uint32_t sRandState = 12345;
+
+static uint32_t Rand(void) {
+    sRandState = sRandState * 1664525u + 1013904223u;
+    return sRandState >> 8;
+}
+
+// Biased towards the extremes so the saturating paths are exercised
+static int16_t RandSample(void) {
+    uint32_t r = Rand();
+
+    switch (r % 4) {
+        case 0:
+            return (r & 4) ? 0x7FFF : -0x8000;
+        default:
+            return (int16_t)Rand();
+    }
+}
+
+// A DMEM address inside the buffer, 16-byte aligned like the audio code uses
+static uint16_t RandAddr(uint16_t base, uint16_t range) {
+    return BUF_START + base + (Rand() % (range / 16)) * 16;
+}
+
+static const char* RunOne(void) {
+    uint16_t count;
+    uint16_t in;
+    uint16_t out;
+
+    for (int i = 0; i < BUF_SIZE / 2; i++) {
+        sInput[i] = RandSample();
+    }
+    Scalar_aLoadBufferImpl(sInput, BUF_START, BUF_SIZE);
+    aLoadBufferImpl(sInput, BUF_START, BUF_SIZE);
+
+    switch (Rand() % 5) {
+        case 0:
+            count = (Rand() % 40) * 16;
+            in = RandAddr(0, 0x200);
+            out = RandAddr(0x400, 0x200);
+            Scalar_aAddMixerImpl(count, in, out);
+            aAddMixerImpl(count, in, out);
+            return "aAddMixer";
+
+        case 1: {
+            int16_t gain = (Rand() % 8 == 0) ? -0x8000 : (int16_t)Rand();
+
+            count = Rand() % 40;
+            in = RandAddr(0, 0x200);
+            out = RandAddr(0x500, 0x200);
+            Scalar_aMixImpl(count, gain, in, out);
+            aMixImpl(count, gain, in, out);
+            return "aMix";
+        }
+
+        case 2: {
+            ADPCM_STATE scalarState = { 0 };
+            ADPCM_STATE simdState = { 0 };
+            uint8_t flags = Rand() % 2;
+
+            count = Rand() % 0x200;
+            in = RandAddr(0, 0x80);
+            Scalar_aSetBufferImpl(0, in, BUF_START + 0x400, count);
+            aSetBufferImpl(0, in, BUF_START + 0x400, count);
+            Scalar_aS8DecImpl(flags, scalarState);
+            aS8DecImpl(flags, simdState);
+            if (memcmp(scalarState, simdState, sizeof(ADPCM_STATE)) != 0) {
+                return "aS8Dec state";
+            }
+            return "aS8Dec";
+        }
+
+        case 3: {
+            uint16_t left = RandAddr(0, 0x100);
+            uint16_t right = RandAddr(0x200, 0x100);
+
+            count = Rand() % 0x100;
+            Scalar_aInterleaveImpl(BUF_START + 0x600, left, right, count);
+            aInterleaveImpl(BUF_START + 0x600, left, right, count);
+            return "aInterleave";
+        }
+
+        default: {
+            uint8_t volWet = Rand();
+            uint16_t rateWet = Rand();
+            uint16_t rateLeft = Rand();
+            uint16_t rateRight = Rand();
+            uint16_t volLeft = Rand();
+            uint16_t volRight = Rand();
+            bool flags[5];
+            int32_t wetDry = ((BUF_START + 0x100) >> 4) << 24 | ((BUF_START + 0x200) >> 4) << 16 |
+                             ((BUF_START + 0x300) >> 4) << 8 | ((BUF_START + 0x400) >> 4);
+
+            for (int i = 0; i < 5; i++) {
+                flags[i] = Rand() & 1;
+            }
+            count = Rand() % 0x60;
+            Scalar_aEnvSetup1Impl(volWet, rateWet, rateLeft, rateRight);
+            aEnvSetup1Impl(volWet, rateWet, rateLeft, rateRight);
+            Scalar_aEnvSetup2Impl(volLeft, volRight);
+            aEnvSetup2Impl(volLeft, volRight);
+            Scalar_aEnvMixerImpl(BUF_START, count, flags[0], flags[1], flags[2], flags[3], flags[4], wetDry, 0);
+            aEnvMixerImpl(BUF_START, count, flags[0], flags[1], flags[2], flags[3], flags[4], wetDry, 0);
+            return "aEnvMixer";
+        }
+    }
+}
+
+int main(void) {
+#ifndef MIXER_TEST_PATH
+    printf("No SIMD mixer path is built for this target, nothing to compare\n");
+    return TEST_SKIPPED;
+#else
+    for (int i = 0; i < ITERATIONS; i++) {
+        const char* kernel = RunOne();
+
+        Scalar_aSaveBufferImpl(BUF_START, sScalarOut, BUF_SIZE);
+        aSaveBufferImpl(BUF_START, sSimdOut, BUF_SIZE);
+        if (strcmp(kernel, "aS8Dec state") == 0 || memcmp(sScalarOut, sSimdOut, sizeof(sScalarOut)) != 0) {
+            printf("%s: %s output differs from the scalar reference (iteration %d)\n", MIXER_TEST_PATH, kernel, i);
+            return 1;
+        }
+    }
+
+    printf("%s: %d calls bit-identical to the scalar reference\n", MIXER_TEST_PATH, ITERATIONS);
+    return 0;
+#endif
+}
@@ -0,0 +1,118 @@
+// Captures a rewind buffer's worth of savestate heap copies the way SaveStateMgr::CaptureRewindState does, with a
+// share of the heap's pages changed between captures. Every state has to load back to the exact heap it captured.
+// Prints the average capture cost next to a plain copy of the heap, for each share of changed pages.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "savestate_heap_copy.h"
+
+// Same size as the game's system heap
+#define HEAP_SIZE (1024 * 1024 * 4)
+#define PAGE_COUNT (HEAP_SIZE / SAVE_STATE_PAGE_SIZE)
+// gRewindBufferSize's default
+#define BUFFER_SIZE 10
+#define CAPTURES 60
+
+struct CapturedState {
+    SaveStateHeapCopy copy;
+    uint64_t hash;
+};
+
+static uint32_t sRandState = 12345;
+
+static uint32_t Rand() {
+    sRandState = sRandState * 1664525u + 1013904223u;
+    return sRandState >> 8;
+}
+
+static uint64_t Hash(const unsigned char* data, size_t size) {
+    uint64_t hash = 14695981039346656037ull;
+
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+static double MsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Writes a few bytes into about dirtyPercent of the heap's pages, like a stretch of gameplay touching the heap
+static void Mutate(unsigned char* heap, size_t dirtyPercent) {
+    for (size_t i = 0; i < PAGE_COUNT; i++) {
+        if (Rand() % 100 >= dirtyPercent) {
+            continue;
+        }
+        for (int j = 0; j < 16; j++) {
+            heap[i * SAVE_STATE_PAGE_SIZE + Rand() % SAVE_STATE_PAGE_SIZE] = Rand();
+        }
+    }
+}
+
+static bool RunOne(size_t dirtyPercent) {
+    std::vector<unsigned char> heap(HEAP_SIZE);
+    std::vector<unsigned char> scratch(HEAP_SIZE);
+    std::deque<std::shared_ptr<CapturedState>> states;
+    std::shared_ptr<CapturedState> last = nullptr;
+    double captureMs = 0;
+    double copyMs = 0;
+
+    for (auto& b : heap) {
+        b = Rand();
+    }
+
+    for (int capture = 0; capture < CAPTURES; capture++) {
+        Mutate(heap.data(), dirtyPercent);
+
+        std::shared_ptr<CapturedState> state = nullptr;
+        while (states.size() >= BUFFER_SIZE) {
+            state = states.front();
+            states.pop_front();
+        }
+        if (state == nullptr) {
+            state = std::make_shared<CapturedState>();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        state->copy.Save(heap.data(), HEAP_SIZE, last != nullptr ? &last->copy : nullptr);
+        captureMs += MsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        memcpy(scratch.data(), heap.data(), HEAP_SIZE);
+        copyMs += MsSince(start);
+
+        state->hash = Hash(heap.data(), HEAP_SIZE);
+        last = state;
+        states.push_back(state);
+    }
+
+    for (size_t i = 0; i < states.size(); i++) {
+        memset(scratch.data(), 0, HEAP_SIZE);
+        states[i]->copy.Load(scratch.data());
+        if (Hash(scratch.data(), HEAP_SIZE) != states[i]->hash) {
+            printf("%zu%% changed: state %zu of %zu does not load back to the heap it captured\n", dirtyPercent, i,
+                   states.size());
+            return false;
+        }
+    }
+
+    printf("%3zu%% of pages changed: capture %.3f ms, plain copy %.3f ms\n", dirtyPercent, captureMs / CAPTURES,
+           copyMs / CAPTURES);
+    return true;
+}
+
+int main() {
+    for (size_t dirtyPercent : { 0, 1, 5, 25, 100 }) {
+        if (!RunOne(dirtyPercent)) {
+            return 1;
+        }
+    }
+    return 0;
+}
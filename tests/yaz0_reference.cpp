@@ -1,60 +1,16 @@
+// The yaz0 encoder and decoder as they were before the hash chain match finder and the bulk copying
+// decoder, kept verbatim apart from the names, the output buffer size and two signedness casts so
+// yaz0_roundtrip_test can check the current codec against them. The old buffer was too small for short
+// or incompressible input.
+
 #include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
 #include <string.h>
-#include <list>
-#include "readwrite.h"
-
-#include "yaz0.h"
+#include <vector>
 
 typedef uint8_t u8;
-typedef uint16_t u16;
 typedef uint32_t u32;
 
-/* internal declarations */
-int yaz0_encode_internal(const u8* src, int srcSize, u8* Data);
-
-int yaz0_get_size(u8* src) { return U32(src + 0x4); }
-
-u32 toDWORD(u32 d) {
-  u8 w1 = d & 0xFF;
-  u8 w2 = (d >> 8) & 0xFF;
-  u8 w3 = (d >> 16) & 0xFF;
-  u8 w4 = d >> 24;
-  return (w1 << 24) | (w2 << 16) | (w3 << 8) | w4;
-}
-
-// simple and straight encoding scheme for Yaz0
-u32 longest_match_brute(const u8* src, int size, int pos, u32* pMatchPos) {
-  int startPos = pos - 0x1000;
-  int max_match_size = size - pos;
-  u32 best_match_size = 0;
-  u32 best_match_pos = 0;
-
-  if (max_match_size < 3) return 0;
-
-  if (startPos < 0) startPos = 0;
-
-  if (max_match_size > 0x111) max_match_size = 0x111;
-
-  for (int i = startPos; i < pos; i++) {
-    int current_size;
-    for (current_size = 0; current_size < max_match_size; current_size++) {
-      if (src[i + current_size] != src[pos + current_size]) {
-	break;
-      }
-    }
-    if (current_size > best_match_size) {
-      best_match_size = current_size;
-      best_match_pos = i;
-      if (best_match_size == 0x111) break;
-    }
-  }
-  *pMatchPos = best_match_pos;
-  return best_match_size;
-}
-
-u32 longest_match_rabinkarp(const u8* src, int size, int pos, u32* match_pos) {
+static u32 Reference_longest_match_rabinkarp(const u8* src, int size, int pos, u32* match_pos) {
   int startPos = pos - 0x1000;
   int max_match_size = size - pos;
   u32 best_match_size = 0;
@@ -77,7 +33,7 @@ u32 longest_match_rabinkarp(const u8* src, int size, int pos, u32* match_pos) {
           break;
         }
       }
-      if (current_size > best_match_size) {
+      if ((u32)current_size > best_match_size) {
         best_match_size = current_size;
         best_match_pos = i;
         if (best_match_size == 0x111) break;
@@ -90,7 +46,7 @@ u32 longest_match_rabinkarp(const u8* src, int size, int pos, u32* match_pos) {
   return best_match_size;
 }
 
-int yaz0_encode_internal(const u8* src, int srcSize, u8* Data) {
+static int Reference_yaz0_encode_internal(const u8* src, int srcSize, u8* Data) {
   int srcPos = 0;
 
   int bitmask = 0x80;
@@ -102,10 +58,8 @@ int yaz0_encode_internal(const u8* src, int srcSize, u8* Data) {
     u32 numBytes;
     u32 matchPos;
 
-    numBytes = longest_match_rabinkarp(src, srcSize, srcPos, &matchPos);
-    //fprintf(stderr, "pos %x len %x pos %x\n", srcPos, (int)numBytes, (int)matchPos);
+    numBytes = Reference_longest_match_rabinkarp(src, srcSize, srcPos, &matchPos);
     if (numBytes < 3) {
-      //fprintf(stderr, "single byte %02x\n", src[srcPos]);
       Data[pos++] = src[srcPos++];
       currCodeByte |= bitmask;
     } else {
@@ -142,52 +96,37 @@ int yaz0_encode_internal(const u8* src, int srcSize, u8* Data) {
   return pos;
 }
 
-std::vector<uint8_t> yaz0_encode_fast(const u8* src, int src_size) {
-  std::vector<uint8_t> buffer;
-  std::vector<std::list<uint32_t>> lut;
-  lut.resize(0x1000000);
-
-  for (int i = 0; i < src_size - 3; ++i) {
-    lut[src[i + 0] << 16 | src[i + 1] << 8 | src[i + 2]].push_back(i);
-  }
-
-  return buffer;
-}
-
-std::vector<uint8_t> yaz0_encode(const u8* src, int src_size) {
-  std::vector<uint8_t> buffer(src_size * 10 / 8 + 16);
+std::vector<uint8_t> Reference_yaz0_encode(const u8* src, int src_size) {
+  // 16 byte header, then one code byte per eight literals in the worst case, plus the code byte the
+  // encoder opens after the last group
+  std::vector<uint8_t> buffer(16 + src_size + (src_size + 7) / 8 + 1);
   u8* dst = buffer.data();
 
   // write 4 bytes yaz0 header
   memcpy(dst, "Yaz0", 4);
 
   // write 4 bytes uncompressed size
-  W32(dst + 4, src_size);
+  dst[4] = src_size >> 24;
+  dst[5] = src_size >> 16;
+  dst[6] = src_size >> 8;
+  dst[7] = src_size;
 
   // encode
-  int dst_size = yaz0_encode_internal(src, src_size, dst + 16);
+  int dst_size = Reference_yaz0_encode_internal(src, src_size, dst + 16);
   int aligned_size = (dst_size + 31) & -16;
   buffer.resize(aligned_size);
 
-#if 0
-  std::vector<uint8_t> decompressed(src_size);
-  yaz0_decode(buffer.data(), decompressed.data(), src_size);
-  if(memcmp(src, decompressed.data(), src_size)) {
-    fprintf(stderr, "Decompressed buffer is different from original\n");
-  }
-#endif
-
   return buffer;
 }
 
-void yaz0_decode(const uint8_t* source, uint8_t* decomp, int32_t decompSize) {
+void Reference_yaz0_decode(const uint8_t* source, uint8_t* decomp, int32_t decompSize) {
   uint32_t srcPlace = 0, dstPlace = 0;
   uint32_t i, dist, copyPlace, numBytes;
   uint8_t codeByte, byte1, byte2;
   uint8_t bitCount = 0;
 
   source += 0x10;
-  while (dstPlace < decompSize) {
+  while (dstPlace < (uint32_t)decompSize) {
     /* If there are no more bits to test, get a new byte */
     if (!bitCount) {
       codeByte = source[srcPlace++];
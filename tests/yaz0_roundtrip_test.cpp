@@ -0,0 +1,212 @@
+// Round-trips random and structured buffers through ZAPD's yaz0 codec at several encoder efforts. Every
+// stream has to decode bit-exactly with both the current decoder and the reference decoder, and the old
+// encoder's streams have to decode with the current decoder. At full effort the encoder has to find
+// the same match lengths as the old encoder, so the compressed size must not change.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "yaz0.h"
+
+std::vector<uint8_t> Reference_yaz0_encode(const uint8_t* src, int src_size);
+void Reference_yaz0_decode(const uint8_t* source, uint8_t* decomp, int32_t decompSize);
+
+// Bytes past the end of every decode buffer that must come back untouched
+#define GUARD_SIZE 32
+#define GUARD_BYTE 0xA5
+
+typedef void (*DecodeFunc)(const uint8_t* source, uint8_t* decomp, int32_t decompSize);
+
+struct TestInput {
+    std::string name;
+    std::vector<uint8_t> data;
+};
+
+static uint32_t sRandState = 12345;
+
+static uint32_t Rand() {
+    sRandState = sRandState * 1664525u + 1013904223u;
+    return sRandState >> 8;
+}
+
+static double sEncodeMs[3];
+static double sDecodeMs;
+static double sReferenceDecodeMs;
+
+static double MsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static std::vector<TestInput> MakeInputs() {
+    std::vector<TestInput> inputs;
+
+    // Sizes around the code byte and minimum match boundaries
+    for (size_t size : { 0, 1, 2, 3, 4, 8, 9, 17, 18, 19 }) {
+        std::vector<uint8_t> data(size);
+        for (auto& b : data) {
+            b = Rand() % 3;
+        }
+        inputs.push_back({ "tiny " + std::to_string(size), data });
+    }
+
+    {
+        std::vector<uint8_t> data(0x10000);
+        for (auto& b : data) {
+            b = Rand();
+        }
+        inputs.push_back({ "random", data });
+    }
+
+    // Long runs, which end up as distance 1 copies of the maximum length
+    inputs.push_back({ "zeros", std::vector<uint8_t>(0x10000, 0) });
+
+    // Overlapping copies with every short period the decoder special-cases
+    for (size_t period = 2; period <= 17; period++) {
+        std::vector<uint8_t> data(0x4000 + period);
+        for (size_t i = 0; i < data.size(); i++) {
+            data[i] = (i % period) * 37 + 1;
+        }
+        inputs.push_back({ "period " + std::to_string(period), data });
+    }
+
+    // Repeats right at the edge of the 4 KiB window
+    for (size_t dist : { 0xFFF, 0x1000, 0x1001 }) {
+        std::vector<uint8_t> data(dist + 0x400);
+        for (size_t i = 0; i < dist; i++) {
+            data[i] = Rand();
+        }
+        memcpy(data.data() + dist, data.data(), 0x400);
+        inputs.push_back({ "window " + std::to_string(dist), data });
+    }
+
+    // Text-like: words from a small dictionary
+    {
+        static const char* words[] = { "link ", "zelda ", "ganon ", "navi ", "rupee ", "hyrule ", "\n", "deku ", "a " };
+        std::vector<uint8_t> data;
+        while (data.size() < 0x10000) {
+            const char* word = words[Rand() % (sizeof(words) / sizeof(words[0]))];
+            data.insert(data.end(), word, word + strlen(word));
+        }
+        inputs.push_back({ "text", data });
+    }
+
+    // Asset-like: big-endian vertices with small deltas, mixed with runs and noise
+    {
+        std::vector<uint8_t> data;
+        int16_t x = 0, y = 0, z = 0;
+        while (data.size() < 0x10000) {
+            switch (Rand() % 4) {
+                case 0:
+                    data.insert(data.end(), Rand() % 0x200, (uint8_t)Rand());
+                    break;
+                case 1:
+                    for (size_t n = Rand() % 64; n > 0; n--) {
+                        data.push_back(Rand());
+                    }
+                    break;
+                default:
+                    for (size_t n = Rand() % 32; n > 0; n--) {
+                        x += Rand() % 16 - 8;
+                        y += Rand() % 16 - 8;
+                        z += Rand() % 16 - 8;
+                        for (int16_t v : { x, y, z, (int16_t)0, (int16_t)(Rand() % 4 * 0x400), (int16_t)0 }) {
+                            data.push_back(v >> 8);
+                            data.push_back(v & 0xFF);
+                        }
+                        data.insert(data.end(), { 0xFF, 0xFF, 0xFF, 0xFF });
+                    }
+                    break;
+            }
+        }
+        inputs.push_back({ "vertices", data });
+    }
+
+    return inputs;
+}
+
+static bool Decodes(const char* what, const TestInput& input, const std::vector<uint8_t>& stream, DecodeFunc decode,
+                    double* ms) {
+    const size_t size = input.data.size();
+    std::vector<uint8_t> out(size + GUARD_SIZE, GUARD_BYTE);
+
+    if (stream.size() < 16 || memcmp(stream.data(), "Yaz0", 4) != 0 ||
+        (size_t)(stream[4] << 24 | stream[5] << 16 | stream[6] << 8 | stream[7]) != size) {
+        printf("%s: %s has a bad header\n", input.name.c_str(), what);
+        return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    decode(stream.data(), out.data(), size);
+    *ms += MsSince(start);
+
+    if (!std::equal(input.data.begin(), input.data.end(), out.begin())) {
+        printf("%s: %s does not decode to the input\n", input.name.c_str(), what);
+        return false;
+    }
+    for (size_t i = size; i < out.size(); i++) {
+        if (out[i] != GUARD_BYTE) {
+            printf("%s: %s wrote past the end of the output\n", input.name.c_str(), what);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool RunOne(const TestInput& input) {
+    static const int efforts[] = { 1, YAZ0_EFFORT_FAST, YAZ0_EFFORT_MAX };
+    const uint8_t* src = input.data.data();
+    const int size = (int)input.data.size();
+    double unused = 0;
+
+    std::vector<uint8_t> reference = Reference_yaz0_encode(src, size);
+    if (!Decodes("reference stream, current decoder", input, reference, yaz0_decode, &unused)) {
+        return false;
+    }
+
+    for (int i = 0; i < 3; i++) {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<uint8_t> stream = yaz0_encode(src, size, efforts[i]);
+        sEncodeMs[i] += MsSince(start);
+
+        std::string what = "effort " + std::to_string(efforts[i]);
+
+        if (yaz0_encode(src, size, efforts[i]) != stream) {
+            printf("%s: %s encodes differently on a second run\n", input.name.c_str(), what.c_str());
+            return false;
+        }
+        if (!Decodes((what + ", current decoder").c_str(), input, stream, yaz0_decode, &sDecodeMs) ||
+            !Decodes((what + ", reference decoder").c_str(), input, stream, Reference_yaz0_decode,
+                     &sReferenceDecodeMs)) {
+            return false;
+        }
+        if (efforts[i] == YAZ0_EFFORT_MAX && stream.size() != reference.size()) {
+            printf("%s: %s is 0x%zX bytes, the reference encoder made 0x%zX\n", input.name.c_str(), what.c_str(),
+                   stream.size(), reference.size());
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::vector<TestInput> inputs = MakeInputs();
+    size_t totalSize = 0;
+
+    for (const TestInput& input : inputs) {
+        if (!RunOne(input)) {
+            return 1;
+        }
+        totalSize += input.data.size();
+    }
+
+    printf("%zu inputs (0x%zX bytes) round-tripped at effort 1, %d and %d\n", inputs.size(), totalSize,
+           YAZ0_EFFORT_FAST, YAZ0_EFFORT_MAX);
+    printf("encode: %.1f / %.1f / %.1f ms, decode: %.1f ms (reference decoder %.1f ms)\n", sEncodeMs[0], sEncodeMs[1],
+           sEncodeMs[2], sDecodeMs, sReferenceDecodeMs);
+    return 0;
+}